@@ -0,0 +1,78 @@
+// Throughput benchmark: decoding asctime()-format records to epoch seconds
+//
+//     strptime() + timegm()     -- the C library
+//     parse_asctime_epoch()     -- scalar, one record at a time
+//     parse_asctime_epoch_batch -- SSSE3 / AVX2 when compiled with -mssse3 / -mavx2
+
+#define _GNU_SOURCE 1
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+
+#include "asctime_parse.h"
+
+namespace {
+
+    const size_t RECORDS = 1u << 20;
+    const size_t STRIDE  = 25;  // 24 characters plus newline
+
+    uint64_t volatile g_sink;
+
+    template<typename F>
+    void measure(const char* name, F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const uint64_t checksum = f();
+        const auto stop = std::chrono::steady_clock::now();
+        g_sink = checksum;
+        const double s = std::chrono::duration<double>(stop - start).count();
+        printf("%-28s %10.1f M records/s   (checksum %llu)\n", name, (double)RECORDS / s / 1e6, (unsigned long long)checksum);
+    }
+
+}
+
+int main()
+{
+    std::vector<char> records(RECORDS * STRIDE);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < RECORDS; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        time_t t = (time_t)((state >> 33) % 4102444800ull); // 1970..2099
+        struct tm tm_utc;
+        char line[32];
+        gmtime_r(&t, &tm_utc);
+        asctime_r(&tm_utc, line);
+        memcpy(&records[i * STRIDE], line, STRIDE);
+    }
+    std::vector<int64_t> out(RECORDS);
+
+    measure("strptime + timegm", [&]() {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < RECORDS; ++i) {
+            struct tm tm_utc;
+            memset(&tm_utc, 0, sizeof(tm_utc));
+            strptime(&records[i * STRIDE], "%a %b %d %H:%M:%S %Y", &tm_utc);
+            sum += (uint64_t)timegm(&tm_utc);
+        }
+        return sum;
+    });
+    measure("parse_asctime_epoch", [&]() {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < RECORDS; ++i) {
+            sum += (uint64_t)SimpleHacks::parse_asctime_epoch(&records[i * STRIDE]);
+        }
+        return sum;
+    });
+    measure("parse_asctime_epoch_batch", [&]() {
+        SimpleHacks::parse_asctime_epoch_batch(records.data(), STRIDE, RECORDS, out.data());
+        uint64_t sum = 0;
+        for (size_t i = 0; i < RECORDS; ++i) {
+            sum += (uint64_t)out[i];
+        }
+        return sum;
+    });
+    return 0;
+}
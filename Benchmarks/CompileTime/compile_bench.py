@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""
+Compile-time throughput benchmark for the UtilHeaders headers.
+
+Generates translation units that stress each header at increasing sizes,
+compiles each one with every requested compiler, and writes a JSON report
+containing (per compiler, per case, per N):
+
+    wall_s            -- wall-clock seconds for the compile
+    peak_rss_kb       -- peak resident set size of the compiler process
+    instantiations    -- template instantiation count (clang -ftime-trace only)
+    template_inst_s   -- seconds in template instantiation (gcc -ftime-report only)
+    ok                -- whether the TU compiled
+
+Usage:
+    python3 compile_bench.py [--cxx g++ clang++] [--sizes 64 256 1024 4096]
+                             [--cases NAME ...] [--out report.json]
+"""
+
+import argparse
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE     = os.path.dirname(os.path.abspath(__file__))
+SRC_DIR  = os.path.normpath(os.path.join(HERE, '..', '..', 'src'))
+
+
+# Each generator returns (source_text, std, extra_flags) for a given N.
+
+def gen_index_sequence(n, portable):
+    src = (
+        '#include "integer_seq.h"\n'
+        'using namespace SimpleHacks::CompileTime;\n'
+        'template<std::size_t... I>\n'
+        'constexpr std::size_t sum(index_sequence<I...>) {\n'
+        '    return sizeof...(I);\n'
+        '}\n'
+        'static_assert(sum(make_index_sequence<%d>{}) == %d, "size");\n'
+    ) % (n, n)
+    flags = ['-DINTEGER_SEQ_FORCE_PORTABLE'] if portable else []
+    return src, 'c++11', flags
+
+def gen_array_size2(n):
+    lines = ['#include "array_size2.h"']
+    for i in range(n):
+        lines.append('static const int a%d[%d] = { 0 };' % (i, i + 1))
+        lines.append('static_assert(ARRAY_SIZE2(a%d) == %d, "size");' % (i, i + 1))
+    return '\n'.join(lines) + '\n', 'c++11', []
+
+def gen_constexpr_strlen(n):
+    literal = 'x' * n
+    src = (
+        '#include <cstddef>\n'
+        '#include "constexpr_strlen.h"\n'
+        'constexpr char s[] = "%s";\n'
+        'static_assert(constexpr_strlen(s) == %d, "array");\n'
+        'static_assert(constexpr_strlen(static_cast<const char*>(s)) == %d, "pointer");\n'
+    ) % (literal, n, n)
+    return src, 'c++17', []
+
+def gen_timestamp(n):
+    lines = ['#include "compile_date.h"', '#include "compile_timestamp.h"']
+    for i in range(n):
+        lines.append('constexpr unsigned d%d = __DATE_MSDOS_INT__ ^ __TIME_MSDOS_INT__ ^ %du;' % (i, i))
+        lines.append('constexpr unsigned t%d = __TIMESTAMP_MSDOS_DATE_INT__ ^ __TIMESTAMP_MSDOS_TIME_INT__ ^ %du;' % (i, i))
+        lines.append('static_assert(__TIMESTAMP_ISO8601_DATETIME__[%d] != 1, "use");' % (i % 19))
+    return '\n'.join(lines) + '\n', 'c++11', []
+
+def gen_sequence_algo(n, algo):
+    src = (
+        '#include "integer_seq_algo.h"\n'
+        'using namespace SimpleHacks::CompileTime;\n'
+        'struct odd { constexpr bool operator()(std::size_t v) const { return (v & 1) != 0; } };\n'
+        'using R = reverse_sequence<make_index_sequence<%d>>;\n'
+    ) % n
+    if algo == 'reverse':
+        src += 'static_assert(sequence_element<0, R>::value == %d, "reverse");\n' % (n - 1)
+    elif algo == 'filter':
+        src += 'static_assert(filter_sequence<R, odd>::size == %d, "filter");\n' % (n // 2)
+    else:
+        src += 'static_assert(std::is_same<sort_sequence<R>, make_index_sequence<%d>>::value, "sort");\n' % n
+    return src, 'c++11', []
+
+def gen_tuple_for_each(n, recursive):
+    src = (
+        '#include <tuple>\n'
+        '#include "tuple_algo.h"\n'
+        'using namespace SimpleHacks::CompileTime;\n'
+        'template<std::size_t I = 0, typename F, typename... T>\n'
+        'typename std::enable_if<I == sizeof...(T)>::type for_each_recursive(std::tuple<T...>&, F&) {}\n'
+        'template<std::size_t I = 0, typename F, typename... T>\n'
+        'typename std::enable_if<I < sizeof...(T)>::type for_each_recursive(std::tuple<T...>& t, F& f) {\n'
+        '    f(std::get<I>(t));\n'
+        '    for_each_recursive<I + 1>(t, f);\n'
+        '}\n'
+        'struct add { long sum; template<typename T> void operator()(T v) { sum += v; } };\n'
+        'std::tuple<%s> t;\n'
+        'long f() { add a = { 0 }; %s; return a.sum; }\n'
+    ) % (', '.join(('char', 'short', 'int', 'long')[i % 4] for i in range(n)),
+         'for_each_recursive(t, a)' if recursive else 'tuple_for_each(t, a)')
+    return src, 'c++11', []
+
+CASES = {
+    'index_sequence'          : lambda n: gen_index_sequence(n, False),
+    'index_sequence_portable' : lambda n: gen_index_sequence(n, True),
+    'array_size2'             : gen_array_size2,
+    'constexpr_strlen'        : gen_constexpr_strlen,
+    'timestamp'               : gen_timestamp,
+    'sequence_reverse'        : lambda n: gen_sequence_algo(n, 'reverse'),
+    'sequence_filter'         : lambda n: gen_sequence_algo(n, 'filter'),
+    'sequence_sort'           : lambda n: gen_sequence_algo(n, 'sort'),
+    'tuple_for_each'          : lambda n: gen_tuple_for_each(n, False),
+    'tuple_for_each_recursive': lambda n: gen_tuple_for_each(n, True),
+}
+
+
+def compiler_kind(cxx):
+    try:
+        out = subprocess.run([cxx, '--version'], stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT, universal_newlines=True).stdout
+    except OSError:
+        return None, None
+    first = out.splitlines()[0] if out else ''
+    return ('clang' if 'clang' in out else 'gcc'), first
+
+def run_measured(cmd):
+    """Run cmd, returning (returncode, wall seconds, peak RSS in KiB, stderr)."""
+    start = time.monotonic()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE,
+                            universal_newlines=True)
+    # wait4() reports the rusage of this child alone, unlike RUSAGE_CHILDREN
+    stderr = proc.stderr.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    wall = time.monotonic() - start
+    proc.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, 'waitstatus_to_exitcode') else status
+    rss = usage.ru_maxrss
+    if sys.platform == 'darwin':
+        rss //= 1024  # macOS reports bytes
+    return proc.returncode, wall, rss, stderr
+
+def count_instantiations(trace_file):
+    try:
+        with open(trace_file) as f:
+            trace = json.load(f)
+    except (OSError, ValueError):
+        return None
+    return sum(1 for e in trace.get('traceEvents', [])
+               if e.get('name') in ('InstantiateClass', 'InstantiateFunction'))
+
+def parse_template_time(stderr):
+    # gcc -ftime-report row:  " template instantiation : 0.01 ( 5%) 0.00 ( 0%) 0.02 ( 7%) 1234k ( 9%)"
+    m = re.search(r'template instantiation\s*:\s*[\d.]+\s*\(\s*\d+%\)\s*[\d.]+\s*\(\s*\d+%\)\s*([\d.]+)', stderr)
+    return float(m.group(1)) if m else None
+
+def bench_one(cxx, kind, case, n, workdir):
+    src, std, flags = CASES[case](n)
+    base = os.path.join(workdir, '%s_%d' % (case, n))
+    cpp  = base + '.cpp'
+    obj  = base + '.o'
+    with open(cpp, 'w') as f:
+        f.write(src)
+
+    cmd = [cxx, '-std=' + std, '-I' + SRC_DIR, '-c', cpp, '-o', obj] + flags
+    if kind == 'clang':
+        cmd += ['-ftime-trace', '-ftime-trace-granularity=0']
+    else:
+        cmd += ['-ftime-report']
+
+    rc, wall, rss, stderr = run_measured(cmd)
+    result = {
+        'case'            : case,
+        'n'               : n,
+        'ok'              : rc == 0,
+        'wall_s'          : round(wall, 4),
+        'peak_rss_kb'     : rss,
+        'instantiations'  : count_instantiations(base + '.json') if kind == 'clang' else None,
+        'template_inst_s' : parse_template_time(stderr) if kind == 'gcc' else None,
+    }
+    if rc != 0:
+        # keep only the first diagnostic, which is enough to see e.g. depth limits
+        errors = [l for l in stderr.splitlines() if 'error' in l]
+        result['error'] = errors[0] if errors else stderr.strip()[:200]
+    return result
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument('--cxx',   nargs='+', default=['g++', 'clang++'])
+    parser.add_argument('--sizes', nargs='+', type=int, default=[64, 256, 1024, 4096])
+    parser.add_argument('--cases', nargs='+', default=sorted(CASES), choices=sorted(CASES))
+    parser.add_argument('--out',   default='compile_bench_report.json')
+    parser.add_argument('--keep',  action='store_true', help='keep generated sources')
+    args = parser.parse_args()
+
+    report = {
+        'host'      : platform.node(),
+        'platform'  : platform.platform(),
+        'timestamp' : time.strftime('%Y-%m-%dT%H:%M:%S'),
+        'compilers' : [],
+    }
+    workdir = tempfile.mkdtemp(prefix='compile_bench_')
+    try:
+        for cxx in args.cxx:
+            kind, version = compiler_kind(cxx)
+            if kind is None:
+                print('skipping %s: not found' % cxx, file=sys.stderr)
+                continue
+            entry = { 'cxx' : cxx, 'kind' : kind, 'version' : version, 'results' : [] }
+            for case in args.cases:
+                for n in args.sizes:
+                    r = bench_one(cxx, kind, case, n, workdir)
+                    entry['results'].append(r)
+                    print('%-10s %-24s N=%-6d %s %8.3fs %8d KiB' % (
+                        cxx, case, n, 'ok  ' if r['ok'] else 'FAIL', r['wall_s'], r['peak_rss_kb']))
+            report['compilers'].append(entry)
+    finally:
+        if args.keep:
+            print('generated sources kept in %s' % workdir)
+        else:
+            shutil.rmtree(workdir, ignore_errors=True)
+
+    with open(args.out, 'w') as f:
+        json.dump(report, f, indent=2)
+    print('report written to %s' % args.out)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,61 @@
+// Microbenchmark: runtime calls to constexpr_strlen(const char*) vs. strlen()
+//
+// Measures short, medium and long strings, each at many different alignments,
+// so the unaligned head of the vectorized scanner is exercised.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "constexpr_strlen.h"
+
+namespace {
+
+    const size_t ALIGNMENTS = 64;
+
+    // prevent the compiler from resolving the pointers at compile time
+    const char* volatile g_sink_ptr;
+    size_t      volatile g_sink_len;
+
+    template<typename F>
+    double ns_per_call(const std::vector<const char*>& strings, size_t iterations, F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        size_t total = 0;
+        for (size_t i = 0; i < iterations; ++i) {
+            g_sink_ptr = strings[i % strings.size()];
+            total += f(g_sink_ptr);
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        g_sink_len = total;
+        return std::chrono::duration<double, std::nano>(stop - start).count() / (double)iterations;
+    }
+
+    size_t via_strlen(const char* s)           { return strlen(s); }
+    size_t via_constexpr_strlen(const char* s) { return constexpr_strlen(s); }
+
+}
+
+int main()
+{
+    const size_t lengths[]    = { 7, 64, 4096 };
+    const size_t iterations[] = { 20000000, 10000000, 500000 };
+
+    printf("%-8s %14s %14s %8s\n", "length", "strlen ns", "constexpr ns", "ratio");
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i) {
+        const size_t len = lengths[i];
+        std::vector<char> storage((len + 1 + ALIGNMENTS) * ALIGNMENTS, 'x');
+        std::vector<const char*> strings;
+        for (size_t a = 0; a < ALIGNMENTS; ++a) {
+            char* s = &storage[a * (len + 1 + ALIGNMENTS) + a];
+            s[len] = '\0';
+            strings.push_back(s);
+        }
+        const double libc = ns_per_call(strings, iterations[i], via_strlen);
+        const double ours = ns_per_call(strings, iterations[i], via_constexpr_strlen);
+        printf("%-8zu %14.2f %14.2f %8.2f\n", len, libc, ours, ours / libc);
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Throughput benchmark: converting between epoch seconds and FAT date / time
+//
+//     gmtime_r() / timegm()     -- the C library, packing the fields by hand
+//     fat_from_epoch() etc.     -- scalar, one timestamp at a time
+//     fat_from_epoch_batch()    -- eight at a time when compiled with -mavx2
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+
+#include "fat_time.h"
+
+using namespace SimpleHacks;
+
+namespace {
+
+    const size_t COUNT = 1u << 22;
+
+    uint64_t volatile g_sink;
+
+    template<typename T, typename F>
+    void measure(const char* name, const std::vector<T>& out, F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        uint64_t checksum = 0;
+        const unsigned char* bytes = (const unsigned char*)out.data();
+        for (size_t i = 0; i < out.size() * sizeof(T); ++i) {
+            checksum = checksum * 31u + bytes[i];
+        }
+        g_sink = checksum;
+        const double s = std::chrono::duration<double>(stop - start).count();
+        printf("%-26s %10.1f M timestamps/s   (checksum %016llx)\n", name, (double)COUNT / s / 1e6, (unsigned long long)checksum);
+    }
+
+}
+
+int main()
+{
+    std::vector<uint64_t> epochs(COUNT);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < COUNT; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        epochs[i] = fat_epoch_min + ((state >> 33) % (fat_epoch_max - fat_epoch_min)) / 2u * 2u;
+    }
+    std::vector<fat_datetime> packed(COUNT);
+    std::vector<fat_fields>   fields(COUNT);
+    std::vector<uint64_t>     back(COUNT);
+
+    printf("epoch seconds to FAT:\n");
+    measure("gmtime_r", packed, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            const time_t t = (time_t)epochs[i];
+            struct tm tm_utc;
+            gmtime_r(&t, &tm_utc);
+            packed[i].date = (uint16_t)(((tm_utc.tm_year - 80) << 9) | ((tm_utc.tm_mon + 1) << 5) | tm_utc.tm_mday);
+            packed[i].time = (uint16_t)((tm_utc.tm_hour << 11) | (tm_utc.tm_min << 5) | (tm_utc.tm_sec >> 1));
+        }
+    });
+    measure("fat_from_epoch", packed, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            packed[i] = fat_from_epoch(epochs[i]);
+        }
+    });
+    measure("fat_from_epoch_batch", packed, [&]() {
+        fat_from_epoch_batch(epochs.data(), COUNT, packed.data());
+    });
+
+    printf("FAT to epoch seconds:\n");
+    measure("timegm", back, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            struct tm tm_utc;
+            memset(&tm_utc, 0, sizeof(tm_utc));
+            tm_utc.tm_year = (packed[i].date >> 9) + 80;
+            tm_utc.tm_mon  = ((packed[i].date >> 5) & 15) - 1;
+            tm_utc.tm_mday = packed[i].date & 31;
+            tm_utc.tm_hour = packed[i].time >> 11;
+            tm_utc.tm_min  = (packed[i].time >> 5) & 63;
+            tm_utc.tm_sec  = (packed[i].time & 31) << 1;
+            back[i] = (uint64_t)timegm(&tm_utc);
+        }
+    });
+    measure("fat_to_epoch", back, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            back[i] = fat_to_epoch(packed[i]);
+        }
+    });
+    measure("fat_to_epoch_batch", back, [&]() {
+        fat_to_epoch_batch(packed.data(), COUNT, back.data());
+    });
+
+    printf("FAT to and from fields:\n");
+    measure("fat_to_fields", fields, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            fields[i] = fat_to_fields(packed[i]);
+        }
+    });
+    measure("fat_to_fields_batch", fields, [&]() {
+        fat_to_fields_batch(packed.data(), COUNT, fields.data());
+    });
+    measure("fat_from_fields", packed, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            packed[i] = fat_from_fields(fields[i]);
+        }
+    });
+    measure("fat_from_fields_batch", packed, [&]() {
+        fat_from_fields_batch(fields.data(), COUNT, packed.data());
+    });
+    return 0;
+}
@@ -0,0 +1,78 @@
+// Throughput benchmark: formatting epoch seconds as "YYYY-MM-DDThh:mm:ss"
+//
+//     gmtime_r() + strftime()   -- the C library
+//     gmtime_r() + snprintf()   -- the C library
+//     format_iso8601()          -- scalar, one timestamp at a time
+//     format_iso8601_batch()    -- SSSE3 digit conversion when compiled with -mssse3
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <vector>
+
+#include "iso8601_format.h"
+
+namespace {
+
+    const size_t COUNT = 1u << 20;
+
+    uint64_t volatile g_sink;
+
+    template<typename F>
+    void measure(const char* name, const std::vector<char>& out, F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        uint64_t checksum = 0;
+        for (size_t i = 0; i < out.size(); ++i) {
+            checksum = checksum * 31u + (unsigned char)out[i];
+        }
+        g_sink = checksum;
+        const double s = std::chrono::duration<double>(stop - start).count();
+        printf("%-26s %10.1f M timestamps/s   (checksum %016llx)\n", name, (double)COUNT / s / 1e6, (unsigned long long)checksum);
+    }
+
+}
+
+int main()
+{
+    std::vector<uint64_t> epochs(COUNT);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < COUNT; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        epochs[i] = (state >> 33) % 4102444800ull; // 1970..2099
+    }
+    std::vector<char> out(COUNT * SimpleHacks::iso8601_length);
+
+    measure("gmtime_r + strftime", out, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            const time_t t = (time_t)epochs[i];
+            struct tm tm_utc;
+            gmtime_r(&t, &tm_utc);
+            strftime(&out[i * SimpleHacks::iso8601_length], SimpleHacks::iso8601_length, "%Y-%m-%dT%H:%M:%S", &tm_utc);
+        }
+    });
+    measure("gmtime_r + snprintf", out, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            const time_t t = (time_t)epochs[i];
+            struct tm tm_utc;
+            gmtime_r(&t, &tm_utc);
+            // bounded so that -Wformat-truncation can see that 20 characters suffice
+            snprintf(&out[i * SimpleHacks::iso8601_length], SimpleHacks::iso8601_length, "%04u-%02u-%02uT%02u:%02u:%02u",
+                     (unsigned)(tm_utc.tm_year + 1900) % 10000u, (unsigned)(tm_utc.tm_mon + 1) % 100u, (unsigned)tm_utc.tm_mday % 100u,
+                     (unsigned)tm_utc.tm_hour % 100u, (unsigned)tm_utc.tm_min % 100u, (unsigned)tm_utc.tm_sec % 100u);
+        }
+    });
+    measure("format_iso8601", out, [&]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            SimpleHacks::format_iso8601(epochs[i], &out[i * SimpleHacks::iso8601_length]);
+        }
+    });
+    measure("format_iso8601_batch", out, [&]() {
+        SimpleHacks::format_iso8601_batch(epochs.data(), COUNT, out.data());
+    });
+    return 0;
+}
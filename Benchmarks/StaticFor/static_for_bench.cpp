@@ -0,0 +1,108 @@
+// Throughput benchmark: loops over small fixed-size packet headers
+//
+//     for loop                  -- a plain loop with a constant trip count
+//     for_each_fixed()          -- fully unrolled through make_index_sequence
+//     for_each_fixed<4>()       -- unrolled by 4, looping over the chunks
+//
+// Each "packet" is an IPv4 header held as ten 16-bit words, and the work
+// per packet is the RFC 1071 one's complement checksum plus a byte-swap
+// of each word.  Whether the plain loop is already unrolled depends on
+// the compiler and flags (e.g., -O3 or -funroll-loops), so compare both.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+#include "static_for.h"
+
+using namespace SimpleHacks::CompileTime;
+
+namespace {
+
+    const size_t COUNT  = 1u << 20;
+    const int    ROUNDS = 16;
+
+    struct ipv4_header {
+        uint16_t words[10];
+    };
+
+    uint64_t volatile g_sink;
+
+    inline uint16_t bswap16(uint16_t x)
+    {
+        return (uint16_t)((x >> 8) | (x << 8));
+    }
+
+    inline uint16_t fold(uint32_t sum)
+    {
+        sum = (sum & 0xFFFFu) + (sum >> 16);
+        sum = (sum & 0xFFFFu) + (sum >> 16);
+        return (uint16_t)~sum;
+    }
+
+    template<typename F>
+    void measure(const char* name, std::vector<ipv4_header>& packets, F f)
+    {
+        uint64_t checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; ++r) {
+            for (size_t i = 0; i < COUNT; ++i) {
+                checksum += f(packets[i]);
+            }
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        g_sink = checksum;
+        const double s = std::chrono::duration<double>(stop - start).count();
+        printf("%-22s %10.1f M headers/s   (checksum %016llx)\n", name, (double)COUNT * ROUNDS / s / 1e6, (unsigned long long)checksum);
+    }
+
+}
+
+int main()
+{
+    std::vector<ipv4_header> packets(COUNT);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < COUNT; ++i) {
+        for (int w = 0; w < 10; ++w) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            packets[i].words[w] = (uint16_t)(state >> 48);
+        }
+    }
+
+    // Every variant swaps each header in place, so after an even number of
+    // ROUNDS the headers (and the checksums) match between variants.
+    measure("for loop", packets, [](ipv4_header& h) -> uint16_t {
+        uint32_t sum = 0;
+        for (int w = 0; w < 10; ++w) {
+            sum += h.words[w];
+            h.words[w] = bswap16(h.words[w]);
+        }
+        return fold(sum);
+    });
+    measure("for_each_fixed", packets, [](ipv4_header& h) -> uint16_t {
+        uint32_t sum = 0;
+        for_each_fixed(h.words, [&](uint16_t& word) {
+            sum += word;
+            word = bswap16(word);
+        });
+        return fold(sum);
+    });
+    measure("for_each_fixed<4>", packets, [](ipv4_header& h) -> uint16_t {
+        uint32_t sum = 0;
+        for_each_fixed<4>(h.words, [&](uint16_t& word) {
+            sum += word;
+            word = bswap16(word);
+        });
+        return fold(sum);
+    });
+    measure("static_for<10>", packets, [](ipv4_header& h) -> uint16_t {
+        uint32_t sum = 0;
+        static_for<10>([&](std::size_t w) {
+            sum += h.words[w];
+            h.words[w] = bswap16(h.words[w]);
+        });
+        return fold(sum);
+    });
+    return 0;
+}
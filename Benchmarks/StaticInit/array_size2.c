@@ -0,0 +1,20 @@
+/* Static-initialization audit:  array_size2.h
+ *
+ * Compiled as both C and C++ (which use different implementations).
+ */
+#include <stddef.h>
+#include "array_size2.h"
+
+static const int    audit_1d[17]         = { 0 };
+static const short  audit_3d[2][3][5]    = { { { 0 } } };
+
+size_t audit_array_size        = ARRAY_SIZE2(audit_1d);
+size_t audit_array_size_3d     = ARRAY_SIZE2(audit_3d);
+size_t audit_array_extent      = ARRAY_EXTENT2(audit_3d, 2);
+size_t audit_array_total       = ARRAY_TOTAL_ELEMENTS2(audit_3d);
+
+size_t audit_array_sum(void)
+{
+    static const size_t sum = ARRAY_SIZE2(audit_1d) + ARRAY_EXTENT2(audit_3d, 1) + ARRAY_TOTAL_ELEMENTS2(audit_3d);
+    return sum;
+}
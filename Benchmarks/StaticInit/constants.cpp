@@ -0,0 +1,81 @@
+// Static-initialization audit:  the C++ headers' compile-time values
+//
+// Every value is used to initialize a namespace-scope variable with a plain
+// (not constexpr) initializer.  The compiler must initialize it statically
+// when the initializer is a constant expression, so a value that silently
+// stopped being one shows up as dynamic initialization instead of an error.
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include "constexpr_strlen.h"
+#include "static_eval.h"
+#include "constexpr_table.h"
+#include "integer_seq_algo.h"
+#include "shuffle_mask.h"
+#if __cpp_constexpr >= 201304
+    #include "constexpr_hash.h"
+    #include "fixed_string.h"
+#endif
+
+using namespace SimpleHacks::CompileTime;
+
+namespace {
+
+    struct crc32_entry {
+        constexpr uint32_t step(uint32_t c, int k) const {
+            return k == 0 ? c : step((c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1), k - 1);
+        }
+        constexpr uint32_t operator()(std::size_t i) const { return step((uint32_t)i, 8); }
+    };
+
+    struct crc_table {
+        constexpr std::array<uint32_t, 256> operator()() const { return make_table<256>(crc32_entry{}); }
+    };
+
+    struct point { int x, y; };
+    struct origin {
+        constexpr point operator()() const { return point{ 3, 4 }; }
+    };
+
+#if __cpp_constexpr >= 201304
+    struct greeting {
+        constexpr fixed_string<12> operator()() const { return make_fixed_string("hello, ") + "world"; }
+    };
+#endif
+
+    struct popcount8 {
+        constexpr uint8_t operator()(std::size_t i) const { return i == 0 ? 0 : (uint8_t)((i & 1) + popcount8{}(i >> 1)); }
+    };
+
+}
+
+std::size_t audit_strlen_array   = constexpr_strlen("hello, world");
+std::size_t audit_static_eval    = static_eval<std::size_t, constexpr_strlen("hello")>::value;
+
+const void* audit_static_constant = &static_constant<crc_table>::value;
+int         audit_static_struct   = static_constant<origin>::value.y;
+const void* audit_chunked_table   = &chunked_table<popcount8, 1024>::value;
+const void* audit_pshufb_mask     = pshufb_mask<byte_swap_pattern<4, 16>>::value;
+const void* audit_permute_mask    = permutevar8x32_mask<reverse_sequence<make_index_sequence<8>>>::value;
+
+#if __cpp_constexpr >= 201304
+std::size_t audit_strlen_pointer = constexpr_strlen(static_cast<const char*>("hello, world"));
+uint32_t    audit_fnv1a_32       = constexpr_fnv1a_32("hello, world");
+uint32_t    audit_xxh32          = constexpr_xxh32("hello, world");
+uint32_t    audit_crc32c         = constexpr_crc32c("hello, world");
+uint32_t    audit_crc_entry      = static_constant<crc_table>::value[1];
+char        audit_fixed_string   = static_constant<greeting>::value[7];
+#endif
+
+#if __cpp_constexpr >= 201603
+// STATIC_CONSTANT is only defined from C++17
+const uint32_t* audit_static_constant_macro = &STATIC_CONSTANT(make_table<16>(crc32_entry{}))[0];
+#endif
+
+std::size_t audit_sum()
+{
+    static const std::size_t sum = constexpr_strlen("hello") + static_constant<origin>::value.x;
+    return sum + static_eval<std::size_t, constexpr_strlen("world")>::value;
+}
@@ -0,0 +1,73 @@
+/* Static-initialization audit:  compile_date.h and compile_timestamp.h
+ *
+ * Compiled as both C and C++.  Every value is used to initialize a global
+ * or function-local static, so any value that is not a constant expression
+ * shows up as dynamic initialization or a guard variable (C++), or as a
+ * compile error (C).  Note that in a C++ function body, the macros are only
+ * guaranteed to be folded when forced, e.g. by a static or static_eval.
+ */
+#include "compile_date.h"
+#include "compile_timestamp.h"
+
+unsigned audit_date_year       = __DATE_YEAR_INT__;
+unsigned audit_date_month      = __DATE_MONTH_INT__;
+unsigned audit_date_day        = __DATE_DAY_INT__;
+unsigned audit_time_hour       = __TIME_HOUR_INT__;
+unsigned audit_time_minute     = __TIME_MINUTE_INT__;
+unsigned audit_time_seconds    = __TIME_SECONDS_INT__;
+unsigned audit_date_msdos      = __DATE_MSDOS_INT__;
+unsigned audit_time_msdos      = __TIME_MSDOS_INT__;
+unsigned long long audit_date_packed = __DATE_PACKED_INT__;
+unsigned long long audit_date_epoch = __DATE_UNIX_EPOCH__;
+
+unsigned audit_ts_year         = __TIMESTAMP_YEAR_INT__;
+unsigned audit_ts_month        = __TIMESTAMP_MONTH_INT__;
+unsigned audit_ts_day          = __TIMESTAMP_DAY_INT__;
+unsigned audit_ts_hour         = __TIMESTAMP_HOUR_INT__;
+unsigned audit_ts_minute       = __TIMESTAMP_MINUTE_INT__;
+unsigned audit_ts_seconds      = __TIMESTAMP_SECONDS_INT__;
+unsigned audit_ts_msdos_date   = __TIMESTAMP_MSDOS_DATE_INT__;
+unsigned audit_ts_msdos_time   = __TIMESTAMP_MSDOS_TIME_INT__;
+unsigned long long audit_ts_packed = __TIMESTAMP_PACKED_INT__;
+unsigned long long audit_ts_epoch = __TIMESTAMP_UNIX_EPOCH__;
+unsigned audit_ts_failure      = __TIMESTAMP_FAILURE__;
+
+const char* audit_date_iso8601          = __DATE_ISO8601_DATE__;
+const char* audit_date_iso8601_datetime = __DATE_ISO8601_DATETIME__;
+const char* audit_ts_iso8601            = __TIMESTAMP_ISO8601_DATE__;
+const char* audit_ts_iso8601_datetime   = __TIMESTAMP_ISO8601_DATETIME__;
+#if defined(__cplusplus)
+// C does not treat an element of a const array as a constant expression
+char        audit_date_iso8601_char     = __DATE_ISO8601_DATE__[4];
+char        audit_ts_iso8601_char       = __TIMESTAMP_ISO8601_DATETIME__[10];
+#endif
+
+const compile_date_info_t*      audit_date_info = &compile_date_info;
+const compile_timestamp_info_t* audit_ts_info   = &compile_timestamp_info;
+
+/* Function-local statics must not need a guard variable */
+unsigned audit_date_sum(void)
+{
+    static const unsigned sum =
+        __DATE_YEAR_INT__ + __DATE_MONTH_INT__ + __DATE_DAY_INT__ +
+        __TIME_HOUR_INT__ + __TIME_MINUTE_INT__ + __TIME_SECONDS_INT__;
+    return sum;
+}
+
+unsigned audit_ts_sum(void)
+{
+    static const unsigned sum =
+        __TIMESTAMP_YEAR_INT__ + __TIMESTAMP_MONTH_INT__ + __TIMESTAMP_DAY_INT__ +
+        __TIMESTAMP_HOUR_INT__ + __TIMESTAMP_MINUTE_INT__ + __TIMESTAMP_SECONDS_INT__;
+    return sum;
+}
+
+const char* audit_date_string(void)
+{
+    return __DATE_ISO8601_DATETIME__;
+}
+
+const char* audit_ts_string(void)
+{
+    return __TIMESTAMP_ISO8601_DATETIME__;
+}
@@ -0,0 +1,12 @@
+// Negative control for the static-initialization audit:  this translation
+// unit must be reported, which shows the checks work with this toolchain.
+
+int audit_runtime_value();
+
+int audit_dynamic = audit_runtime_value();
+
+const int& audit_guarded()
+{
+    static const int value = audit_runtime_value();
+    return value;
+}
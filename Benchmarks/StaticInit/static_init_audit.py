@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""
+Static-initialization audit for the UtilHeaders compile-time constants.
+
+Compiles the translation units in this directory, which initialize plain
+(non-constexpr) globals from every constant the headers expose, for each
+language standard and optimization level.  Then it inspects each object
+file and fails if it finds any of these:
+
+    init section     -- .init_array / .preinit_array / .ctors / .text.startup
+    init function    -- _GLOBAL__sub_I_* (the TU's dynamic initializer)
+    guard variable   -- _ZGV* (a function-local static initialized at runtime)
+    undefined symbol -- anything other than _GLOBAL_OFFSET_TABLE_
+    runtime call     -- a call instruction, or a call / tail-call relocation
+
+A negative control (dynamic_init.cpp) must be reported for every C++
+configuration, which shows the checks work with this toolchain.
+
+Usage:
+    python3 static_init_audit.py [--cc gcc] [--cxx g++] [--nm nm] [--objdump objdump]
+                                 [--c-stds c99 c11] [--cxx-stds c++11 c++14 c++17 c++20]
+                                 [--opts O0 O2] [--keep]
+
+Exits with status 1 if any translation unit fails, or if the negative
+control is not reported.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE     = os.path.dirname(os.path.abspath(__file__))
+SRC_DIR  = os.path.normpath(os.path.join(HERE, '..', '..', 'src'))
+
+# (source, compiled as C, compiled as C++)
+SOURCES = [
+    ('date_time.c',   True,  True ),
+    ('timestamp.c',   True,  True ),
+    ('array_size2.c', True,  True ),
+    ('constants.cpp', False, True ),
+]
+NEGATIVE_CONTROL = 'dynamic_init.cpp'
+
+INIT_SECTIONS     = ('.init_array', '.preinit_array', '.ctors', '.text.startup')
+ALLOWED_UNDEFINED = ('_GLOBAL_OFFSET_TABLE_',)
+
+# call mnemonics for x86, ARM / AArch64, RISC-V and MIPS
+CALL_INSN  = re.compile(r'^\s*[0-9a-f]+:\s+(?:[0-9a-f]{2,8}\s)*\s*(call[lq]?|bl|blx|blr|jal|jalr)\b')
+# relocations used for calls and tail calls
+CALL_RELOC = re.compile(r'\bR_[A-Z0-9]+_(PLT32|PLT|PLT31|CALL26|JUMP26|CALL|CALL_PLT|JUMP_SLOT|PC24|THM_CALL|26)\b')
+
+
+def tool_ok(tool):
+    return shutil.which(tool) is not None
+
+def std_supported(compiler, lang, std, workdir):
+    probe = os.path.join(workdir, 'probe.' + ('c' if lang == 'c' else 'cpp'))
+    with open(probe, 'w') as f:
+        f.write('int probe;\n')
+    proc = subprocess.run([compiler, '-x', lang, '-std=' + std, '-fsyntax-only', probe],
+                          stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return proc.returncode == 0
+
+def output_of(cmd):
+    return subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                          universal_newlines=True).stdout
+
+def inspect(obj, nm, objdump):
+    """Returns a list of problems found in the object file."""
+    problems = []
+
+    for line in output_of([objdump, '-h', obj]).splitlines():
+        fields = line.split()
+        if len(fields) > 1 and fields[0].isdigit():
+            name = fields[1]
+            if any(name == s or name.startswith(s + '.') for s in INIT_SECTIONS):
+                problems.append('init section %s' % name)
+
+    for line in output_of([nm, obj]).splitlines():
+        fields = line.split()
+        if not fields:
+            continue
+        symbol = fields[-1]
+        if len(fields) == 2 and fields[0] in ('U', 'w', 'v'):
+            if fields[0] == 'U' and symbol not in ALLOWED_UNDEFINED:
+                problems.append('undefined symbol %s' % symbol)
+        if symbol.startswith('_GLOBAL__sub_I') or symbol.startswith('_GLOBAL__I'):
+            problems.append('init function %s' % symbol)
+        elif symbol.startswith('_ZGV'):
+            problems.append('guard variable %s' % symbol)
+
+    for line in output_of([objdump, '-dr', '--no-show-raw-insn', obj]).splitlines():
+        m = CALL_INSN.match(line)
+        if m:
+            problems.append('runtime call: %s' % ' '.join(line.split()[1:]))
+            continue
+        m = CALL_RELOC.search(line)
+        if m:
+            problems.append('call relocation: %s' % ' '.join(line.split()[1:]))
+
+    # report each distinct problem once
+    return sorted(set(problems))
+
+def audit_one(compiler, lang, std, opt, source, workdir, nm, objdump):
+    src = os.path.join(HERE, source)
+    obj = os.path.join(workdir, '%s.%s.%s.%s.o' % (source, lang, std, opt))
+    cmd = [compiler, '-x', lang, '-std=' + std, '-' + opt, '-I' + SRC_DIR, '-c', src, '-o', obj]
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                          universal_newlines=True)
+    if proc.returncode != 0:
+        errors = [l for l in proc.stdout.splitlines() if 'error' in l]
+        return ['compile failed: %s' % (errors[0] if errors else proc.stdout.strip()[:200])]
+    return inspect(obj, nm, objdump)
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument('--cc',       default=os.environ.get('CC', 'gcc'))
+    parser.add_argument('--cxx',      default=os.environ.get('CXX', 'g++'))
+    parser.add_argument('--nm',       default='nm')
+    parser.add_argument('--objdump',  default='objdump')
+    parser.add_argument('--c-stds',   nargs='+', default=['c99', 'c11'])
+    parser.add_argument('--cxx-stds', nargs='+', default=['c++11', 'c++14', 'c++17', 'c++20'])
+    parser.add_argument('--opts',     nargs='+', default=['O0', 'O2'], help='optimization levels, without the dash')
+    parser.add_argument('--keep',     action='store_true', help='keep object files')
+    args = parser.parse_args()
+
+    for tool in (args.cc, args.cxx, args.nm, args.objdump):
+        if not tool_ok(tool):
+            print('error: %s not found' % tool, file=sys.stderr)
+            return 2
+
+    failures = 0
+    control_misses = 0
+    workdir = tempfile.mkdtemp(prefix='static_init_audit_')
+    try:
+        for lang, compiler, stds in (('c', args.cc, args.c_stds), ('c++', args.cxx, args.cxx_stds)):
+            for std in stds:
+                if not std_supported(compiler, lang, std, workdir):
+                    print('skip  %-4s -std=%-6s not supported by %s' % (lang, std, compiler))
+                    continue
+                for opt in args.opts:
+                    for source, as_c, as_cxx in SOURCES:
+                        if not (as_c if lang == 'c' else as_cxx):
+                            continue
+                        problems = audit_one(compiler, lang, std, opt, source, workdir, args.nm, args.objdump)
+                        print('%-5s %-4s -std=%-6s -%-3s %s' % ('ok' if not problems else 'FAIL', lang, std, opt, source))
+                        for p in problems:
+                            print('          %s' % p)
+                        failures += 1 if problems else 0
+                    if lang == 'c++':
+                        problems = audit_one(compiler, lang, std, opt, NEGATIVE_CONTROL, workdir, args.nm, args.objdump)
+                        detected = problems and not any(p.startswith('compile failed') for p in problems)
+                        print('%-5s %-4s -std=%-6s -%-3s %s (negative control)' % ('ok' if detected else 'FAIL', lang, std, opt, NEGATIVE_CONTROL))
+                        if not detected:
+                            for p in problems:
+                                print('          %s' % p)
+                            print('          dynamic initialization was not detected')
+                        control_misses += 0 if detected else 1
+    finally:
+        if args.keep:
+            print('object files kept in %s' % workdir)
+        else:
+            shutil.rmtree(workdir, ignore_errors=True)
+
+    if failures or control_misses:
+        print('%d translation unit(s) with dynamic initialization or runtime calls, '
+              '%d negative control(s) not detected' % (failures, control_misses))
+        return 1
+    print('no dynamic initialization found')
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,27 @@
+/* Static-initialization audit:  timestamp.h
+ *
+ * Compiled as both C and C++.  timestamp.h defines the same names as
+ * compile_timestamp.h, so it is audited in its own translation unit.
+ */
+#include "timestamp.h"
+
+unsigned audit_ts_year         = __TIMESTAMP_YEAR_INT__;
+unsigned audit_ts_month        = __TIMESTAMP_MONTH_INT__;
+unsigned audit_ts_day          = __TIMESTAMP_DAY_INT__;
+unsigned audit_ts_hour         = __TIMESTAMP_HOUR_INT__;
+unsigned audit_ts_minute       = __TIMESTAMP_MINUTE_INT__;
+unsigned audit_ts_seconds      = __TIMESTAMP_SECONDS_INT__;
+unsigned audit_ts_msdos_date   = __TIMESTAMP_MSDOS_DATE_INT__;
+unsigned audit_ts_msdos_time   = __TIMESTAMP_MSDOS_TIME_INT__;
+
+const char* audit_ts_iso8601          = __TIMESTAMP_ISO8601_DATE__;
+const char* audit_ts_iso8601_datetime = __TIMESTAMP_ISO8601_DATETIME__;
+#if defined(__cplusplus)
+// C does not treat an element of a const array as a constant expression
+char        audit_ts_iso8601_char     = __TIMESTAMP_ISO8601_DATETIME__[10];
+#endif
+
+const char* audit_ts_string(void)
+{
+    return __TIMESTAMP_ISO8601_DATETIME__;
+}
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <type_traits>
+
+#include "array_view.h"
+
+// This example verifies which conversions static_span and array_view accept:
+// arrays and cv-qualifying conversions compile, while pointers and
+// Derived-to-Base conversions are rejected at compile time.
+// e.g., g++ -std=c++14 -I../../src main.cpp
+
+using namespace SimpleHacks;
+
+namespace {
+
+    struct Base            { int b; };
+    struct Derived : Base  { int d; };
+
+    // pointers do not decay into a view
+    static_assert( std::is_constructible<static_span<int, 4>, int (&)[4]>::value,       "array to static_span" );
+    static_assert(!std::is_constructible<static_span<int, 4>, int*>::value,             "pointer to static_span" );
+    static_assert( std::is_constructible<array_view<int>, int (&)[4]>::value,           "array to array_view" );
+    static_assert(!std::is_constructible<array_view<int>, int*>::value,                 "pointer to array_view" );
+
+    // adding const is allowed, removing it is not
+    static_assert( std::is_convertible<static_span<int, 4>, static_span<const int, 4>>::value, "T to const T" );
+    static_assert(!std::is_convertible<static_span<const int, 4>, static_span<int, 4>>::value, "const T to T" );
+    static_assert( std::is_convertible<static_span<int, 4>, array_view<const int>>::value,     "span to view of const T" );
+    static_assert(!std::is_convertible<static_span<const int, 4>, array_view<int>>::value,     "span of const T to view of T" );
+
+    // extents must match
+    static_assert(!std::is_convertible<static_span<int, 4>, static_span<int, 3>>::value,       "different extents" );
+
+    // Derived to Base would index the Derived array in steps of sizeof(Base)
+    static_assert(!std::is_constructible<static_span<Base, 4>, Derived (&)[4]>::value,         "Derived array to Base span" );
+    static_assert(!std::is_convertible<static_span<Derived, 4>, static_span<Base, 4>>::value,  "Derived span to Base span" );
+    static_assert(!std::is_convertible<static_span<Derived, 4>, array_view<Base>>::value,      "Derived span to Base view" );
+    static_assert(!std::is_constructible<array_view<Base>, Derived (&)[4]>::value,             "Derived array to Base view" );
+
+    int sum( array_view<const int> v )
+    {
+        int result = 0;
+        for (int x : v) {
+            result += x;
+        }
+        return result;
+    }
+
+}
+
+int main()
+{
+    int failures = 0;
+    int values[5] = { 1, 2, 3, 4, 5 };
+
+    static_span<int, 5>       s(values);
+    static_span<const int, 5> cs = s;
+    array_view<const int>     cv = cs;
+    if (sum(values) != 15 || sum(cs) != 15 || cv.size() != 5) {
+        printf("conversion mismatch\n");
+        ++failures;
+    }
+
+    const static_span<int, 3> tail = s.subspan<2>();
+    const static_span<int, 2> mid  = s.subspan<1, 2>();
+    if (tail.size() != 3 || tail[0] != 3 || get<2>(tail) != 5 || mid[0] != 2 || mid[1] != 3) {
+        printf("subspan mismatch\n");
+        ++failures;
+    }
+
+    s.for_each([](int& x) { x *= 2; });
+    if (sum(cv) != 30 || cs.get<4>() != 10) {
+        printf("for_each mismatch\n");
+        ++failures;
+    }
+
+    Derived ds[4] = {};
+    static_span<Derived, 4> dspan(ds);
+    if (&dspan[1].b != &ds[1].b) {
+        printf("Derived span mismatch\n");
+        ++failures;
+    }
+
+    printf("%s\n", failures == 0 ? "static_span and array_view conversions behave as expected" : "MISMATCH");
+    return failures;
+}
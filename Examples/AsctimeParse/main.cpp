@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "asctime_parse.h"
+
+// This example verifies parse_asctime() and parse_asctime_epoch() against
+// known values, and that the batch functions give the same results as the
+// scalar functions, for every count from 0 to 67 (so that each tail length
+// after the eight-record AVX2 loop is covered) and for several strides.
+// Build it with and without SIMD, e.g.,
+//     g++ -std=c++14 -I../../src main.cpp
+//     g++ -std=c++14 -mssse3 -I../../src main.cpp
+//     g++ -std=c++14 -mavx2 -I../../src main.cpp
+
+using namespace SimpleHacks;
+
+// known values, from Python's calendar.timegm()
+static_assert(parse_asctime_epoch("Sun Sep 16 01:03:52 1973") ==     116989432, "1973");
+static_assert(parse_asctime_epoch("Thu Jan  1 00:00:00 1970") ==             0, "epoch");
+static_assert(parse_asctime_epoch("Wed Dec 31 23:59:59 1969") ==            -1, "before the epoch");
+static_assert(parse_asctime_epoch("Mon Jan  1 00:00:00 1900") ==   -2208988800, "1900");
+static_assert(parse_asctime_epoch("Sat Jan  1 00:00:00 1601") ==  -11644473600, "1601");
+static_assert(parse_asctime_epoch("Tue Feb 29 12:00:00 2000") ==     951825600, "leap day");
+static_assert(parse_asctime_epoch("Fri Dec 31 23:59:59 9999") ==  253402300799, "9999");
+static_assert(parse_asctime("Sun Sep  6 01:03:52 1973").day == 6, "single-digit day");
+static_assert(parse_asctime("Sun Sep 16 01:03:52 1973").month == 9, "month");
+static_assert(parse_asctime("??? ??? ?? ??:??:?? ????").failure != 0, "unknown timestamp");
+static_assert(parse_asctime("??? ??? ?? ??:??:?? ????").year == 1980, "unknown timestamp");
+
+static const char* const weekdays[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+static const char* const months[]   = { "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+static bool is_leap(int y) { return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0; }
+
+static int days_in_month(int y, int m)
+{
+    static const int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return days[m] + (m == 1 && is_leap(y));
+}
+
+// Formats t as asctime() would, by counting days one year and month at a time:
+// a reference that shares no arithmetic with the header.
+static void format_asctime(int64_t t, char* s)
+{
+    int64_t days = (t >= 0 ? t : t - 86399) / 86400;
+    const int sec = (int)(t - days * 86400);
+    const int weekday = (int)(((days + 4) % 7 + 7) % 7); // 1970-01-01 was a Thursday
+    int y = 1970;
+    while (days < 0)                          { --y; days += is_leap(y) ? 366 : 365; }
+    while (days >= (is_leap(y) ? 366 : 365))  { days -= is_leap(y) ? 366 : 365; ++y; }
+    int m = 0;
+    while (days >= days_in_month(y, m))       { days -= days_in_month(y, m); ++m; }
+    char line[64];
+    snprintf(line, sizeof(line), "%.3s %.3s %2d %02d:%02d:%02d %4d",
+             weekdays[weekday], months[m], (int)days + 1, sec / 3600, sec / 60 % 60, sec % 60, y);
+    memcpy(s, line, asctime_length);
+}
+
+static bool same(const asctime_fields& a, const asctime_fields& b)
+{
+    return a.year == b.year && a.month == b.month && a.day == b.day && a.hour == b.hour &&
+           a.minute == b.minute && a.seconds == b.seconds && a.failure == b.failure;
+}
+
+static const size_t RECORDS = 67;
+static const size_t MAX_STRIDE = 40;
+static int64_t expected[RECORDS];
+
+// Outside main(): gcc 12 at -O2 can give an array declared in a loop body the
+// same stack slot as the array inlined from parse_asctime_epoch_batch() (gcc PR 90348).
+static asctime_fields fields[RECORDS + 1];
+static int64_t        epochs[RECORDS + 1];
+
+// prevent the compiler from folding the runtime calls
+static const char* volatile g_runtime;
+
+int main()
+{
+    // 1601 .. 2199, one record with a '?' (record 13), and one at the epoch
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < RECORDS; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        expected[i] = (int64_t)((state >> 20) % 18902592000ull) - 11644473600;
+    }
+    expected[0] = 0;
+
+    int failures = 0;
+    static const size_t strides[] = { 24, 25, 32, 37, MAX_STRIDE };
+    for (size_t k = 0; k < sizeof(strides) / sizeof(strides[0]); ++k) {
+        const size_t stride = strides[k];
+        // bytes between records are filler, which must not affect the result
+        static char records[RECORDS * MAX_STRIDE];
+        memset(records, 'x', sizeof(records));
+        for (size_t i = 0; i < RECORDS; ++i) {
+            format_asctime(expected[i], records + i * stride);
+        }
+        memcpy(records + 13 * stride + 11, "??", 2);
+
+        g_runtime = records;
+        const char* r = g_runtime;
+        for (size_t i = 0; i < RECORDS; ++i) {
+            const asctime_fields f = parse_asctime(r + i * stride);
+            const int64_t epoch = parse_asctime_epoch(r + i * stride);
+            if (f.failure != (i == 13) || (i != 13 && epoch != expected[i])) {
+                printf("parse_asctime_epoch mismatch: \"%.24s\"\n", r + i * stride);
+                ++failures;
+            }
+        }
+        for (size_t count = 0; count <= RECORDS; ++count) {
+            // an extra element, which must not be written
+            fields[count].year = 0xFFFF;
+            epochs[count]      = 12345;
+            parse_asctime_batch(r, stride, count, fields);
+            parse_asctime_epoch_batch(r, stride, count, epochs);
+            for (size_t i = 0; i < count; ++i) {
+                if (!same(fields[i], parse_asctime(r + i * stride)) ||
+                    epochs[i] != parse_asctime_epoch(r + i * stride)) {
+                    printf("batch mismatch: stride %u, count %u, record %u\n",
+                           (unsigned)stride, (unsigned)count, (unsigned)i);
+                    ++failures;
+                }
+            }
+            if (fields[count].year != 0xFFFF || epochs[count] != 12345) {
+                printf("batch wrote past the end: stride %u, count %u\n", (unsigned)stride, (unsigned)count);
+                ++failures;
+            }
+        }
+    }
+
+    if (failures == 0) {
+        printf("asctime_parse: scalar and batch results match for %u records\n", (unsigned)RECORDS);
+    }
+    return failures;
+}
@@ -0,0 +1,55 @@
+#include <stdio.h>
+
+#include "constexpr_hash.h"
+#include "static_eval.h"
+
+// This example verifies that each hash gives the same value when evaluated
+// at compile time and at runtime, for a small corpus of inputs.
+// e.g., g++ -std=c++17 -msse4.2 -I../../src main.cpp
+
+#define CORPUS(X)                                           \
+    X("")                                                   \
+    X("a")                                                  \
+    X("abc")                                                \
+    X("123456789")                                          \
+    X("hello, world")                                       \
+    X("0123456789abcdef")                                   \
+    X("Nobody inspects the spammish repetition")            \
+    X("The quick brown fox jumps over the lazy dog.......") \
+    X("\xff\x80\x7f\x01 high and low bytes")
+
+// known values from the reference implementations
+static_assert(constexpr_fnv1a_32("a")         == 0xE40C292Cu,           "FNV-1a 32");
+static_assert(constexpr_fnv1a_64("a")         == 0xAF63DC4C8601EC8Cull, "FNV-1a 64");
+static_assert(constexpr_xxh32("abc")          == 0x32D153FFu,           "xxHash32");
+static_assert(constexpr_crc32c("123456789")   == 0xE3069283u,           "CRC32C");
+
+// prevent the compiler from folding the runtime calls
+static const char* volatile g_runtime;
+
+static int check(const char* s, uint32_t fnv32, uint64_t fnv64, uint32_t xxh, uint32_t crc)
+{
+    g_runtime = s;
+    const char* r = g_runtime;
+    int failures = 0;
+    if (constexpr_fnv1a_32(r) != fnv32) { printf("FNV-1a 32 mismatch: \"%s\"\n", s); ++failures; }
+    if (constexpr_fnv1a_64(r) != fnv64) { printf("FNV-1a 64 mismatch: \"%s\"\n", s); ++failures; }
+    if (constexpr_xxh32(r)    != xxh  ) { printf("xxHash32  mismatch: \"%s\"\n", s); ++failures; }
+    if (constexpr_crc32c(r)   != crc  ) { printf("CRC32C    mismatch: \"%s\"\n", s); ++failures; }
+    return failures;
+}
+
+#define CHECK_ONE(str)                                                     \
+    failures += check(str,                                                 \
+        static_eval<uint32_t, constexpr_fnv1a_32(str)>::value,             \
+        static_eval<uint64_t, constexpr_fnv1a_64(str)>::value,             \
+        static_eval<uint32_t, constexpr_xxh32(str)>::value,                \
+        static_eval<uint32_t, constexpr_crc32c(str)>::value);
+
+int main()
+{
+    int failures = 0;
+    CORPUS(CHECK_ONE)
+    printf("%s\n", failures == 0 ? "compile-time and runtime hashes match" : "MISMATCH");
+    return failures;
+}
@@ -0,0 +1,78 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "timestamp.h"
+#include "fat_image.h"
+
+// This example generates the metadata of a small FAT volume at compile time,
+// then writes the whole volume to a file, one sector at a time, the same
+// way a USB mass-storage read handler would.  The result can be inspected
+// with, e.g., `fsck.fat -n volume.img` or `mdir -i volume.img`.
+// e.g., g++ -std=c++14 -I../../src main.cpp && ./a.out volume.img
+
+static const char info_uf2[] =
+    "UF2 Bootloader v1.0.0\r\n"
+    "Model: Example Board\r\n"
+    "Board-ID: Example-Board-v1\r\n";
+
+static const char index_htm[] =
+    "<!doctype html>\n"
+    "<html><body><script>location.replace(\"https://example.com/\");</script></body></html>\n";
+
+static char current_uf2[3000];
+
+static const char* const contents[] = { info_uf2, index_htm, current_uf2 };
+
+constexpr SimpleHacks::fat_volume volume = {
+    "UF2BOOT", 8000, 1, 64, __TIMESTAMP_MSDOS_DATE_INT__, __TIMESTAMP_MSDOS_TIME_INT__, 0x00420042u
+};
+
+constexpr SimpleHacks::fat_file files[] = {
+    { "INFO_UF2.TXT", sizeof(info_uf2) - 1u, 0, 0 },
+    { "INDEX.HTM",    sizeof(index_htm) - 1u, 0, 0 },
+    { "CURRENT.UF2",  sizeof(current_uf2),    0, 0 },
+};
+
+// the boot sector, FAT and root directory are constant data, in flash
+constexpr auto image = FAT_IMAGE(volume, files);
+
+static_assert(image.boot[510] == 0x55 && image.boot[511] == 0xAA, "boot sector signature");
+static_assert(ARRAY_SIZE2(image.fat) == 512u, "three small files use one sector of the FAT");
+
+static void read_sector(uint32_t lba, uint8_t* out)
+{
+    size_t file;
+    uint32_t offset;
+    if (!image.read_sector(lba, out, &file, &offset)) {
+        const uint32_t remaining = image.file_size[file] - offset;
+        const uint32_t count = remaining < SimpleHacks::fat_sector_size ? remaining : (uint32_t)SimpleHacks::fat_sector_size;
+        memcpy(out, contents[file] + offset, count);
+        memset(out + count, 0, SimpleHacks::fat_sector_size - count);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* path = argc > 1 ? argv[1] : "volume.img";
+    for (size_t i = 0; i < sizeof(current_uf2); ++i) {
+        current_uf2[i] = (char)('A' + i % 26u);
+    }
+
+    FILE* f = fopen(path, "wb");
+    if (!f) {
+        printf("unable to create %s\n", path);
+        return 1;
+    }
+    uint8_t sector[SimpleHacks::fat_sector_size];
+    for (uint32_t lba = 0; lba < image.total_sectors; ++lba) {
+        read_sector(lba, sector);
+        fwrite(sector, 1, sizeof(sector), f);
+    }
+    fclose(f);
+
+    printf("wrote %u sectors to %s:  FAT at %u (%u sectors each), root at %u, data at %u\n",
+           (unsigned)image.total_sectors, path, (unsigned)image.fat_start, (unsigned)image.fat_sectors,
+           (unsigned)image.root_start, (unsigned)image.data_start);
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "fat_time.h"
+
+// This example exhaustively verifies the conversions in fat_time.h:  every
+// two-second timestamp from 1980-01-01 00:00:00 to 2107-12-31 23:59:58 is
+// converted from epoch seconds to FAT, to fields, and back again, with both
+// the scalar and the batch functions.
+// e.g., g++ -std=c++14 -O2 -mavx2 -I../../src main.cpp
+
+using namespace SimpleHacks;
+
+// the same functions, evaluated at compile time
+static_assert(fat_to_epoch(fat_datetime{ 0x0000, 0x0021 }) == fat_epoch_min,             "1980-01-01 00:00:00");
+static_assert(fat_to_epoch(fat_datetime{ 0xBF7D, 0xFF9F }) == fat_epoch_max,             "2107-12-31 23:59:58");
+static_assert(fat_from_epoch(1671940097ull).date == ((42u << 9) | (12u << 5) | 25u),     "2022-12-25");
+static_assert(fat_from_epoch(1671940097ull).time == ((3u << 11) | (48u << 5) | (17u / 2u)), "03:48:16");
+static_assert(fat_from_epoch(0).date == 0x0021 && fat_from_epoch(~0ull).date == 0xFF9F, "clamped");
+
+namespace {
+
+    const uint32_t SECONDS_PER_DAY = 86400u;
+    const uint32_t TIMES_PER_DAY   = SECONDS_PER_DAY / 2u;
+
+    bool is_leap(unsigned y) { return (y % 4u == 0u && y % 100u != 0u) || y % 400u == 0u; }
+
+    unsigned month_length(unsigned y, unsigned m)
+    {
+        static const unsigned length[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        return length[m - 1u] + (m == 2u && is_leap(y));
+    }
+
+    bool same(const fat_fields& a, const fat_fields& b)
+    {
+        return a.year == b.year && a.month == b.month && a.day == b.day &&
+               a.hour == b.hour && a.minute == b.minute && a.seconds == b.seconds;
+    }
+
+}
+
+int main()
+{
+    std::vector<uint64_t>     epochs(TIMES_PER_DAY);
+    std::vector<uint64_t>     back(TIMES_PER_DAY);
+    std::vector<fat_datetime> packed(TIMES_PER_DAY);
+    std::vector<fat_datetime> repacked(TIMES_PER_DAY);
+    std::vector<fat_fields>   fields(TIMES_PER_DAY);
+    unsigned long long checked = 0;
+    unsigned failures = 0;
+
+    uint64_t day_start = fat_epoch_min;
+    for (unsigned y = 1980; y <= 2107; ++y) {
+        for (unsigned m = 1; m <= 12; ++m) {
+            for (unsigned d = 1; d <= month_length(y, m); ++d, day_start += SECONDS_PER_DAY) {
+                for (uint32_t i = 0; i < TIMES_PER_DAY; ++i) {
+                    // odd seconds round down to the same value
+                    epochs[i] = day_start + 2u * i + (i & 1u);
+                }
+                fat_from_epoch_batch(&epochs[0], TIMES_PER_DAY, &packed[0]);
+                fat_to_fields_batch(&packed[0], TIMES_PER_DAY, &fields[0]);
+                fat_from_fields_batch(&fields[0], TIMES_PER_DAY, &repacked[0]);
+                fat_to_epoch_batch(&repacked[0], TIMES_PER_DAY, &back[0]);
+
+                for (uint32_t i = 0; i < TIMES_PER_DAY; ++i) {
+                    const uint32_t sod = 2u * i;
+                    const fat_fields expected = {
+                        (uint16_t)y, (uint8_t)m, (uint8_t)d,
+                        (uint8_t)(sod / 3600u), (uint8_t)(sod / 60u % 60u), (uint8_t)(sod % 60u), 0
+                    };
+                    const fat_datetime scalar = fat_from_epoch(epochs[i]);
+                    const bool ok =
+                        same(fields[i], expected) &&
+                        same(fat_to_fields(scalar), expected) &&
+                        memcmp(&packed[i], &scalar, sizeof(scalar)) == 0 &&
+                        memcmp(&repacked[i], &scalar, sizeof(scalar)) == 0 &&
+                        back[i] == day_start + sod &&
+                        fat_to_epoch(scalar) == day_start + sod;
+                    if (!ok && ++failures <= 10u) {
+                        printf("mismatch at %04u-%02u-%02u, second %u:  epoch %llu -> date %04x time %04x -> %llu\n",
+                               y, m, d, sod, (unsigned long long)epochs[i], packed[i].date, packed[i].time,
+                               (unsigned long long)back[i]);
+                    }
+                }
+                checked += TIMES_PER_DAY;
+            }
+        }
+    }
+
+    if (day_start - 2u != fat_epoch_max) {
+        printf("unexpected end of range: %llu\n", (unsigned long long)day_start);
+        ++failures;
+    }
+
+    // out-of-range epochs clamp to the first and last timestamps
+    const uint64_t outside[8] = { 0, 1, fat_epoch_min - 1u, fat_epoch_max + 1u, fat_epoch_max + 2u, 1ull << 40, 1ull << 63, ~0ull };
+    fat_datetime clamped[8];
+    fat_from_epoch_batch(outside, 8, clamped);
+    for (int i = 0; i < 8; ++i) {
+        const uint64_t expected = (outside[i] < fat_epoch_min) ? fat_epoch_min : fat_epoch_max;
+        if (fat_to_epoch(clamped[i]) != expected || fat_to_epoch(fat_from_epoch(outside[i])) != expected) {
+            printf("clamping failed for %llu\n", (unsigned long long)outside[i]);
+            ++failures;
+        }
+    }
+
+    printf("%llu timestamps checked, %u failures\n", checked, failures);
+    return failures ? 1 : 0;
+}
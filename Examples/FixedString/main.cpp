@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <type_traits>
+
+#include "fixed_string.h"
+
+// This example verifies fixed_string's concatenation, substr(), find() and
+// comparison at compile time, and that the same operations give the same
+// results at runtime.  In C++20, it also uses fixed_string as a non-type
+// template parameter.  Build it with each standard, e.g.,
+//     g++ -std=c++14 -I../../src main.cpp
+//     g++ -std=c++20 -I../../src main.cpp
+// A substr() position past the end must fail through substr()'s static_assert,
+// e.g., g++ -std=c++14 -DFIXED_STRING_SUBSTR_PAST_THE_END -I../../src main.cpp
+// must report "substr() position is past the end of the string".
+
+using namespace SimpleHacks::CompileTime;
+
+constexpr auto net    = make_fixed_string("[net] ");
+constexpr auto prefix = net + "rx: ";
+constexpr auto empty  = make_fixed_string("");
+
+// concatenation, with a fixed_string or a string literal on either side
+static_assert(prefix.size() == 10, "concatenation length");
+static_assert(prefix == make_fixed_string("[net] rx: "), "fixed_string + literal");
+static_assert("<" + net + ">" == make_fixed_string("<[net] >"), "literal + fixed_string");
+static_assert(net + empty == net && empty + net == net, "empty concatenation");
+static_assert(prefix[prefix.size()] == '\0', "null terminated");
+
+// substr(), including the default length and lengths past the end
+static_assert(prefix.substr<1, 3>() == make_fixed_string("net"), "substr");
+static_assert(prefix.substr<6>() == make_fixed_string("rx: "), "substr default length");
+static_assert(prefix.substr<6, 100>() == make_fixed_string("rx: "), "substr length past the end");
+static_assert(prefix.substr<10>().empty(), "substr at the end");
+static_assert(prefix.substr<0, 0>().empty(), "substr of length zero");
+
+// A position past the end clamps the result's length to zero, rather than
+// wrapping, so that substr()'s static_assert is the error that is reported.
+static_assert(_Detail::fixed_substr_length(10, 11, (size_t)-1) == 0, "position past the end");
+static_assert(_Detail::fixed_substr_length(10, (size_t)-1, 1) == 0, "position far past the end");
+static_assert(_Detail::fixed_substr_length(10, 4, (size_t)-1) == 6, "default length");
+static_assert(_Detail::fixed_substr_length(10, 4, 7) == 6, "length past the end");
+static_assert(_Detail::fixed_substr_length(10, 4, 2) == 2, "length within the string");
+#if defined(FIXED_STRING_SUBSTR_PAST_THE_END)
+static_assert(prefix.substr<11>().empty(), "must not compile");
+#endif
+
+// find()
+static_assert(prefix.find('r') == 6, "find char");
+static_assert(prefix.find("rx") == 6, "find string");
+static_assert(prefix.find('n', 2) == decltype(prefix)::npos, "find char after pos");
+static_assert(prefix.find("tx") == decltype(prefix)::npos, "find missing string");
+static_assert(prefix.find("") == 0, "find empty string");
+
+// comparison, as per std::string::compare()
+static_assert(make_fixed_string("abc").compare(make_fixed_string("abc")) == 0, "equal");
+static_assert(make_fixed_string("abc").compare(make_fixed_string("abd")) <  0, "less");
+static_assert(make_fixed_string("abc").compare(make_fixed_string("ab"))  >  0, "longer");
+static_assert(make_fixed_string("ab") < make_fixed_string("abc"), "prefix sorts first");
+static_assert(make_fixed_string("\xff") > make_fixed_string("a"), "compared as unsigned char");
+static_assert(make_fixed_string("abc") != make_fixed_string("abcd"), "different lengths");
+static_assert(make_fixed_string("b") >= make_fixed_string("a") && make_fixed_string("a") <= make_fixed_string("a"), "<= and >=");
+
+// decimal digits
+static_assert(fixed_string_decimal<4>(2022) == make_fixed_string("2022"), "decimal");
+static_assert(fixed_string_decimal<2>(7) == make_fixed_string("07"), "zero padded");
+static_assert(fixed_string_decimal<2>(1999) == make_fixed_string("99"), "lowest digits");
+
+#if __cpp_nontype_template_args >= 201911
+    // C++20: fixed_string as a non-type template parameter
+    template<fixed_string Name>
+    struct counter { static constexpr auto name = Name; };
+
+    static_assert(counter<"rx_packets">::name == make_fixed_string("rx_packets"), "NTTP value");
+    static_assert(sizeof(counter<"rx_packets">::name) == sizeof("rx_packets"), "NTTP length");
+    static_assert(!std::is_same<counter<"rx">, counter<"tx">>::value, "distinct NTTP values");
+    static_assert(std::is_same<counter<"rx">, counter<fixed_string("rx")>>::value, "equal NTTP values");
+#endif
+
+// prevent the compiler from folding the runtime operations
+static volatile char g_runtime = 'n';
+
+static int check(const char* what, bool ok)
+{
+    if (!ok) {
+        printf("MISMATCH: %s\n", what);
+    }
+    return ok ? 0 : 1;
+}
+
+int main()
+{
+    int failures = 0;
+
+    fixed_string<3> name = make_fixed_string("xet");
+    name[0] = g_runtime;
+    const auto runtime_prefix = "[" + name + "] " + "rx: ";
+    failures += check("concatenation", strcmp(runtime_prefix.c_str(), "[net] rx: ") == 0);
+    failures += check("substr",        strcmp(runtime_prefix.substr<1, 3>().c_str(), "net") == 0);
+    failures += check("substr default length", strcmp(runtime_prefix.substr<6>().c_str(), "rx: ") == 0);
+    failures += check("find",          runtime_prefix.find("rx") == 6 && runtime_prefix.find('z') == decltype(prefix)::npos);
+    failures += check("equality",      runtime_prefix == prefix && runtime_prefix.compare(prefix) == 0);
+
+    name[2] = (char)(g_runtime + 7); // "neu" > "net"
+    failures += check("comparison",    name > prefix.substr<1, 3>() && name.compare(prefix.substr<1, 3>()) == 1);
+    failures += check("compare with a longer string", name.compare(runtime_prefix.substr<1>()) == 1);
+
+    if (failures == 0) {
+        printf("fixed_string: compile-time and runtime results match\n");
+    }
+    return failures;
+}
@@ -0,0 +1,210 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "shuffle_mask.h"
+
+#if defined(__SSSE3__)
+    #include <immintrin.h>
+#endif
+#if defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+// This example verifies the masks generated by shuffle_mask.h.  Each pattern
+// is applied to a source buffer directly, and the result compared to
+// applying the generated mask with a scalar model of the instruction (and,
+// when compiled for it, with the instruction itself).
+// e.g., g++ -std=c++11 -O2 -mavx2 -I../../src main.cpp
+
+using namespace SimpleHacks::CompileTime;
+
+// big-endian 16-bit fields, and a 32-bit lane reversal as bytes
+static_assert(std::is_same<byte_swap_pattern<2, 4>, byte_pattern<1, 0, 3, 2>>::value, "byte_swap_pattern");
+static_assert(std::is_same<expand_lanes<byte_pattern<1, shuffle_zero>, 2>, byte_pattern<2, 3, shuffle_zero, shuffle_zero>>::value, "expand_lanes");
+static_assert(pshufb_mask<byte_swap_pattern<4, 16>>::value[0] == 3, "pshufb_mask");
+static_assert(pshufb_mask<byte_pattern<shuffle_zero, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15>>::value[0] == 0x80, "shuffle_zero");
+
+namespace {
+
+    int g_failures = 0;
+
+    template<typename T, T... P>
+    void apply_pattern(const uint8_t* src, size_t lane_bytes, uint8_t* out, integer_sequence<T, P...>)
+    {
+        const int pattern[] = { static_cast<int>(P)... };
+        for (size_t i = 0; i < sizeof...(P); ++i) {
+            for (size_t b = 0; b < lane_bytes; ++b) {
+                out[i * lane_bytes + b] = (pattern[i] == shuffle_zero) ? 0 : src[(size_t)pattern[i] * lane_bytes + b];
+            }
+        }
+    }
+
+    void check(const char* name, const uint8_t* expected, const uint8_t* actual, size_t n)
+    {
+        if (memcmp(expected, actual, n) != 0) {
+            printf("FAIL: %s\n", name);
+            ++g_failures;
+        }
+    }
+
+    bool is_aligned(const void* p, size_t alignment)
+    {
+        return ((uintptr_t)p % alignment) == 0;
+    }
+
+    template<typename Pattern>
+    void test_pshufb(const char* name, const uint8_t* src)
+    {
+        const size_t n = Pattern::size;
+        const uint8_t* mask = pshufb_mask<Pattern>::value;
+        uint8_t expected[32], actual[32];
+        apply_pattern(src, 1, expected, Pattern{});
+
+        // scalar model:  bit 7 clears, else the low four bits index the same 128-bit lane
+        for (size_t i = 0; i < n; ++i) {
+            actual[i] = (mask[i] & 0x80) ? 0 : src[(i / 16) * 16 + (mask[i] & 15)];
+        }
+        check(name, expected, actual, n);
+        if (!is_aligned(mask, n)) {
+            printf("FAIL: %s is not aligned\n", name);
+            ++g_failures;
+        }
+#if defined(__SSSE3__)
+        if (n == 16) {
+            const __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src), _mm_load_si128((const __m128i*)mask));
+            _mm_storeu_si128((__m128i*)actual, v);
+            check(name, expected, actual, n);
+        }
+#endif
+#if defined(__AVX2__)
+        if (n == 32) {
+            const __m256i v = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)src), _mm256_load_si256((const __m256i*)mask));
+            _mm256_storeu_si256((__m256i*)actual, v);
+            check(name, expected, actual, n);
+        }
+#endif
+    }
+
+    template<typename Pattern>
+    void test_permutevar8x32(const char* name, const uint8_t* src)
+    {
+        const int32_t* mask = permutevar8x32_mask<Pattern>::value;
+        uint8_t expected[32], actual[32];
+        apply_pattern(src, 4, expected, Pattern{});
+
+        for (size_t i = 0; i < 8; ++i) {
+            memcpy(actual + i * 4, src + (size_t)(mask[i] & 7) * 4, 4);
+        }
+        check(name, expected, actual, 32);
+#if defined(__AVX2__)
+        const __m256i v = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*)src), _mm256_load_si256((const __m256i*)mask));
+        _mm256_storeu_si256((__m256i*)actual, v);
+        check(name, expected, actual, 32);
+#endif
+    }
+
+    template<typename Pattern, size_t TableBytes>
+    void test_neon_tbl(const char* name, const uint8_t* src)
+    {
+        const size_t n = Pattern::size;
+        const uint8_t* mask = neon_tbl_mask<Pattern, TableBytes>::value;
+        uint8_t expected[16], actual[16];
+        apply_pattern(src, 1, expected, Pattern{});
+
+        // scalar model:  any index beyond the table gives zero
+        for (size_t i = 0; i < n; ++i) {
+            actual[i] = (mask[i] < TableBytes) ? src[mask[i]] : 0;
+        }
+        check(name, expected, actual, n);
+#if defined(__ARM_NEON) && defined(__aarch64__)
+        if (n == 16 && TableBytes == 16) {
+            vst1q_u8(actual, vqtbl1q_u8(vld1q_u8(src), vld1q_u8(mask)));
+            check(name, expected, actual, n);
+        }
+#endif
+    }
+
+    // Compacts the 32-bit lanes selected by a 4-bit mask to the front,
+    // clearing the rest: the table is indexed by the mask at runtime.
+    struct left_pack {
+        constexpr int nth_set(std::size_t bits, std::size_t n, int lane) const {
+            return (lane == 4) ? shuffle_zero :
+                   ((bits >> lane) & 1) ? (n == 0 ? lane : nth_set(bits, n - 1, lane + 1)) :
+                   nth_set(bits, n, lane + 1);
+        }
+        constexpr int operator()(std::size_t entry, std::size_t position) const {
+            return (nth_set(entry, position / 4, 0) == shuffle_zero) ? shuffle_zero : nth_set(entry, position / 4, 0) * 4 + (int)(position % 4);
+        }
+    };
+
+    void test_left_pack(const uint8_t* src)
+    {
+        typedef pshufb_mask_table<left_pack, 16> table;
+        for (unsigned bits = 0; bits < 16; ++bits) {
+            uint8_t expected[16], actual[16];
+            memset(expected, 0, sizeof(expected));
+            size_t out = 0;
+            for (unsigned lane = 0; lane < 4; ++lane) {
+                if (bits & (1u << lane)) {
+                    memcpy(expected + out * 4, src + lane * 4, 4);
+                    ++out;
+                }
+            }
+            for (size_t i = 0; i < 16; ++i) {
+                actual[i] = (table::value[bits][i] & 0x80) ? 0 : src[table::value[bits][i] & 15];
+            }
+            check("pshufb_mask_table<left_pack>", expected, actual, 16);
+#if defined(__SSSE3__)
+            const __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src), _mm_load_si128((const __m128i*)table::value[bits]));
+            _mm_storeu_si128((__m128i*)actual, v);
+            check("pshufb_mask_table<left_pack>", expected, actual, 16);
+#endif
+        }
+    }
+
+}
+
+int main()
+{
+    uint8_t src[64];
+    for (size_t i = 0; i < sizeof(src); ++i) {
+        src[i] = (uint8_t)(0xA0 + i);
+    }
+
+    typedef byte_pattern<
+        15, 14, 13, 12, 11, 10, 9, 8,
+        shuffle_zero, shuffle_zero, 0, 0, 1, 1, 2, 2
+        > mixed16;
+    typedef concat_sequence<
+        byte_swap_pattern<4, 16>,
+        expand_lanes<byte_pattern<7, shuffle_zero, 4, 5>, 4>
+        > avx2_halves;
+
+    test_pshufb<byte_swap_pattern<2, 16>>("pshufb bswap16", src);
+    test_pshufb<byte_swap_pattern<4, 16>>("pshufb bswap32", src);
+    test_pshufb<byte_swap_pattern<8, 16>>("pshufb bswap64", src);
+    test_pshufb<mixed16>("pshufb mixed", src);
+    test_pshufb<reverse_sequence<make_integer_sequence<int, 16>>>("pshufb reverse", src);
+    test_pshufb<byte_swap_pattern<4, 32>>("vpshufb bswap32", src);
+    // the second lane's indices are [16, 32), as they select from the upper 128 bits
+    test_pshufb<concat_sequence<
+        byte_swap_pattern<4, 16>,
+        byte_pattern<31, 30, 29, 28, shuffle_zero, shuffle_zero, shuffle_zero, shuffle_zero, 16, 17, 18, 19, 20, 21, 22, 23>
+        >>("vpshufb mixed", src);
+    test_pshufb<avx2_halves>("vpshufb expand_lanes", src);
+
+    test_permutevar8x32<reverse_sequence<make_index_sequence<8>>>("permutevar8x32 reverse", src);
+    test_permutevar8x32<byte_pattern<0, 0, 7, 7, 3, 2, 1, 0>>("permutevar8x32 gather", src);
+
+    test_neon_tbl<byte_swap_pattern<4, 16>, 16>("vqtbl1q bswap32", src);
+    test_neon_tbl<byte_pattern<7, 6, 5, 4, shuffle_zero, 0, 1, 2>, 8>("vtbl1 mixed", src);
+    test_neon_tbl<byte_pattern<15, 8, 31, 16, shuffle_zero, 0, 1, 2>, 32>("vtbl4 mixed", src);
+
+    test_left_pack(src);
+
+    if (g_failures == 0) {
+        printf("All shuffle masks verified.\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+#include "static_string_map.h"
+#include "static_eval.h"
+
+// This example verifies static_string_map lookups (hits and misses) at
+// compile time and at runtime, for the default and a non-default Seed, and
+// that a map with a duplicate key constructed at runtime aborts.  (The same
+// map declared constexpr fails to compile, naming STATIC_STRING_MAP_DUPLICATE_KEY.)
+// e.g., g++ -std=c++14 -I../../src main.cpp
+
+using namespace SimpleHacks::CompileTime;
+
+#define FIELDS                  \
+    { "length",        1 },     \
+    { "offset",        2 },     \
+    { "flags",         3 },     \
+    { "checksum",      4 },     \
+    { "ttl",           5 },     \
+    { "protocol",      6 },     \
+    { "source",        7 },     \
+    { "destination",   8 },     \
+    { "options",       9 },     \
+    { "",             10 }
+
+constexpr auto fields = make_static_string_map<int>({ FIELDS });
+constexpr auto seeded = make_static_string_map<int, 0x9E3779B97F4A7C15ull>({ FIELDS });
+
+static_assert(fields.size() == 10 && fields.slot_count() == 32 && fields.bucket_count() == 16, "sizes");
+static_assert(*fields.find("offset") == 2 && *seeded.find("offset") == 2,              "hit");
+static_assert(*fields.find("") == 10 && *seeded.find("") == 10,                         "empty key");
+static_assert(fields.find("off") == nullptr && seeded.find("offsets") == nullptr,       "miss");
+static_assert(*fields.find("ttl-and-more", 3) == 5,                                     "explicit length");
+static_assert(static_eval<int, *fields.find("options")>::value == 9,                    "static_eval");
+
+namespace {
+
+    const char* const g_keys[] = {
+        "length", "offset", "flags", "checksum", "ttl", "protocol", "source", "destination", "options", ""
+    };
+    const char* const g_misses[] = {
+        "Length", "lengt", "lengthh", "flag", "ttl ", "x", "destinatio", "optionz"
+    };
+
+    // prevent the compiler from folding the runtime lookups
+    const char* volatile g_runtime;
+
+    template<typename Map>
+    int check( const char* name, const Map& map )
+    {
+        int failures = 0;
+        for (size_t i = 0; i < sizeof(g_keys) / sizeof(g_keys[0]); ++i) {
+            g_runtime = g_keys[i];
+            const int* v = map.find(g_runtime);
+            if (v == nullptr || *v != (int)i + 1) {
+                printf("%s: miss for key \"%s\"\n", name, g_keys[i]);
+                ++failures;
+            }
+        }
+        for (size_t i = 0; i < sizeof(g_misses) / sizeof(g_misses[0]); ++i) {
+            g_runtime = g_misses[i];
+            if (map.contains(g_runtime)) {
+                printf("%s: hit for non-key \"%s\"\n", name, g_misses[i]);
+                ++failures;
+            }
+        }
+        size_t used = 0;
+        for (size_t i = 0; i < map.slot_count(); ++i) {
+            used += (map.slots()[i].key != nullptr) ? 1u : 0u;
+        }
+        if (used != map.size()) {
+            printf("%s: %u slots used, expected %u\n", name, (unsigned)used, (unsigned)map.size());
+            ++failures;
+        }
+        return failures;
+    }
+
+    int duplicate_key_aborts()
+    {
+    #if defined(__unix__) || defined(__APPLE__)
+        fflush(stdout);
+        const pid_t pid = fork();
+        if (pid == 0) {
+            // not constexpr, so this is constructed at runtime
+            auto map = make_static_string_map<int>({ { "a", 1 }, { "b", 2 }, { "a", 3 } });
+            g_runtime = "b";
+            _exit(map.find(g_runtime) != nullptr ? 0 : 1);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!WIFSIGNALED(status)) {
+            printf("duplicate key was not rejected at runtime\n");
+            return 1;
+        }
+    #endif
+        return 0;
+    }
+
+}
+
+int main()
+{
+    int failures = 0;
+    failures += check("constexpr map", fields);
+    failures += check("seeded map", seeded);
+
+    // the same keys, constructed at runtime, must give the same lookups
+    const auto runtime_map = make_static_string_map<int>({ FIELDS });
+    failures += check("runtime map", runtime_map);
+
+    failures += duplicate_key_aborts();
+
+    printf("%s\n", failures == 0 ? "static_string_map lookups behave as expected" : "MISMATCH");
+    return failures;
+}
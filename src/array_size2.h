@@ -67,6 +67,62 @@ SOFTWARE.
     } /* namespace detail */
     #define ARRAY_SIZE2(arr) detail::ARRAY_SIZE2_ARGUMENT_CANNOT_BE_POINTER(arr)
 
+    namespace detail
+    {
+        /* element type, rank and total element count of (multi-dimensional) array types */
+        template <typename T>
+        struct ARRAY_SIZE2_TRAITS
+        {
+            typedef T element_type;
+            static constexpr size_t rank  = 0;
+            static constexpr size_t total = 1;
+        };
+        template <typename T, size_t N>
+        struct ARRAY_SIZE2_TRAITS<T[N]>
+        {
+            typedef typename ARRAY_SIZE2_TRAITS<T>::element_type element_type;
+            static constexpr size_t rank  = 1 + ARRAY_SIZE2_TRAITS<T>::rank;
+            static constexpr size_t total = N * ARRAY_SIZE2_TRAITS<T>::total;
+        };
+
+        template <typename T, size_t Dim>
+        struct ARRAY_EXTENT2_OF
+        {
+            static_assert(Dim != Dim, "ARRAY_EXTENT2: dim must be less than the rank of the array");
+        };
+        template <typename T, size_t N>
+        struct ARRAY_EXTENT2_OF<T[N], 0>
+        {
+            static constexpr size_t value = N;
+        };
+        template <typename T, size_t N, size_t Dim>
+        struct ARRAY_EXTENT2_OF<T[N], Dim>
+        {
+            static constexpr size_t value = ARRAY_EXTENT2_OF<T, Dim - 1>::value;
+        };
+
+        template <size_t Dim, typename T, size_t N>
+        constexpr size_t ARRAY_EXTENT2_ARGUMENT_CANNOT_BE_POINTER(T const (&)[N]) noexcept
+        {
+            return ARRAY_EXTENT2_OF<T[N], Dim>::value;
+        }
+        template <typename T, size_t N>
+        constexpr size_t ARRAY_TOTAL_ELEMENTS2_ARGUMENT_CANNOT_BE_POINTER(T const (&)[N]) noexcept
+        {
+            return ARRAY_SIZE2_TRAITS<T[N]>::total;
+        }
+        template <typename T, size_t N>
+        inline typename ARRAY_SIZE2_TRAITS<T>::element_type (&
+        ARRAY_FLATTEN2_ARGUMENT_CANNOT_BE_POINTER(T (&arr)[N]) noexcept)[ARRAY_SIZE2_TRAITS<T[N]>::total]
+        {
+            /* the elements of a multi-dimensional array are contiguous, without padding */
+            return reinterpret_cast<typename ARRAY_SIZE2_TRAITS<T>::element_type (&)[ARRAY_SIZE2_TRAITS<T[N]>::total]>(arr);
+        }
+    } /* namespace detail */
+    #define ARRAY_EXTENT2(arr, dim)    detail::ARRAY_EXTENT2_ARGUMENT_CANNOT_BE_POINTER<(dim)>(arr)
+    #define ARRAY_TOTAL_ELEMENTS2(arr) detail::ARRAY_TOTAL_ELEMENTS2_ARGUMENT_CANNOT_BE_POINTER(arr)
+    #define ARRAY_FLATTEN2(arr)        detail::ARRAY_FLATTEN2_ARGUMENT_CANNOT_BE_POINTER(arr)
+
 #elif defined(__cplusplus) && __cplusplus >= 199711L && ( /* C++ 98 trick */   \
       defined(__INTEL_COMPILER) ||                     \
       defined(__clang__) ||                            \
@@ -83,6 +139,46 @@ SOFTWARE.
     char(&_ArraySizeHelperRequiresArray(T(&)[N]))[N];
     #define ARRAY_SIZE2(x) sizeof(_ArraySizeHelperRequiresArray(x))
 
+    /* element type, rank and total element count of (multi-dimensional) array types */
+    template <typename T>
+    struct _ArraySize2Traits {
+        typedef T element_type;
+        enum { rank = 0 };
+        static const size_t total = 1;
+    };
+    template <typename T, size_t N>
+    struct _ArraySize2Traits<T[N]> {
+        typedef typename _ArraySize2Traits<T>::element_type element_type;
+        enum { rank = 1 + _ArraySize2Traits<T>::rank };
+        static const size_t total = N * _ArraySize2Traits<T>::total;
+    };
+    /* no value member (compile-time error) when Dim is not less than the rank */
+    template <typename T, size_t Dim>
+    struct _ArrayExtent2Of {};
+    template <typename T, size_t N>
+    struct _ArrayExtent2Of<T[N], 0> {
+        static const size_t value = N;
+    };
+    template <typename T, size_t N, size_t Dim>
+    struct _ArrayExtent2Of<T[N], Dim> {
+        static const size_t value = _ArrayExtent2Of<T, Dim - 1>::value;
+    };
+
+    template <size_t Dim, typename T, size_t N>
+    char(&_ArrayExtentHelperRequiresArray(T(&)[N]))[_ArrayExtent2Of<T[N], Dim>::value];
+    template <typename T, size_t N>
+    char(&_ArrayTotalElementsHelperRequiresArray(T(&)[N]))[_ArraySize2Traits<T[N]>::total];
+    template <typename T, size_t N>
+    inline typename _ArraySize2Traits<T>::element_type (&
+    _ArrayFlattenRequiresArray(T(&arr)[N]))[_ArraySize2Traits<T[N]>::total]
+    {
+        /* the elements of a multi-dimensional array are contiguous, without padding */
+        return reinterpret_cast<typename _ArraySize2Traits<T>::element_type (&)[_ArraySize2Traits<T[N]>::total]>(arr);
+    }
+    #define ARRAY_EXTENT2(x, dim)    sizeof(_ArrayExtentHelperRequiresArray<(dim)>(x))
+    #define ARRAY_TOTAL_ELEMENTS2(x) sizeof(_ArrayTotalElementsHelperRequiresArray(x))
+    #define ARRAY_FLATTEN2(x)        _ArrayFlattenRequiresArray(x)
+
 #elif defined(__cplusplus) /* && ((__cplusplus >= 199711L) || defined(__INTEL_COMPILER) || defined(__clang__)) */
     
     #if defined(ARRAYSIZE2_SHOW_VERSION_MESSAGE)
@@ -139,6 +235,31 @@ SOFTWARE.
     #define __SIMPLEHACKS_MUST_BE_ARRAY__(x)        __SIMPLEHACKS_BUILD_ERROR_ON_NONZERO__(__SIMPLEHACKS_COMPATIBLE_TYPES__((x), &(*x)))
     #define ARRAY_SIZE2(_arr)       ( (sizeof(_arr) / sizeof((_arr)[0])) + __SIMPLEHACKS_MUST_BE_ARRAY__(_arr) ) /* compile-time error if not an array */
 
+    /**
+        ARRAY_EXTENT2(arr, dim) requires dim to be a literal 0..3, and
+        ARRAY_TOTAL_ELEMENTS2 / ARRAY_FLATTEN2 support arrays of rank 1..4
+        (a compile-time error otherwise).  Each level of the array must be
+        an array, not a pointer.
+    */
+    #define __SIMPLEHACKS_EXTENT2_0__(_arr) ARRAY_SIZE2(_arr)
+    #define __SIMPLEHACKS_EXTENT2_1__(_arr) ( ARRAY_SIZE2((_arr)[0])       + __SIMPLEHACKS_MUST_BE_ARRAY__(_arr) )
+    #define __SIMPLEHACKS_EXTENT2_2__(_arr) ( ARRAY_SIZE2((_arr)[0][0])    + __SIMPLEHACKS_MUST_BE_ARRAY__(_arr) + __SIMPLEHACKS_MUST_BE_ARRAY__((_arr)[0]) )
+    #define __SIMPLEHACKS_EXTENT2_3__(_arr) ( ARRAY_SIZE2((_arr)[0][0][0]) + __SIMPLEHACKS_MUST_BE_ARRAY__(_arr) + __SIMPLEHACKS_MUST_BE_ARRAY__((_arr)[0]) + __SIMPLEHACKS_MUST_BE_ARRAY__((_arr)[0][0]) )
+    #define ARRAY_EXTENT2(_arr, dim)        __SIMPLEHACKS_EXTENT2_##dim##__(_arr)
+
+    /* arrays decay to pointers through the comma operator; other types, including pointers, are unchanged */
+    #define __SIMPLEHACKS_IS_ARRAY__(x)     (!__SIMPLEHACKS_COMPATIBLE_TYPES__((x), ((void)0, (x))))
+    /* the first element of an array, or x itself when x is not an array */
+    #define __SIMPLEHACKS_FIRST_ELEMENT__(x) (__builtin_choose_expr(__SIMPLEHACKS_IS_ARRAY__(x), (x), &(x)))[0]
+    #define __SIMPLEHACKS_FIRST_SCALAR__(x) \
+        __SIMPLEHACKS_FIRST_ELEMENT__(__SIMPLEHACKS_FIRST_ELEMENT__(__SIMPLEHACKS_FIRST_ELEMENT__(__SIMPLEHACKS_FIRST_ELEMENT__(x))))
+    #define ARRAY_TOTAL_ELEMENTS2(_arr) ( \
+        (sizeof(_arr) / sizeof(__SIMPLEHACKS_FIRST_SCALAR__(_arr))) + \
+        __SIMPLEHACKS_MUST_BE_ARRAY__(_arr) + \
+        __SIMPLEHACKS_BUILD_ERROR_ON_NONZERO__(__SIMPLEHACKS_IS_ARRAY__(__SIMPLEHACKS_FIRST_SCALAR__(_arr))) ) /* compile-time error if rank > 4 */
+    #define ARRAY_FLATTEN2(_arr) \
+        (*(__typeof__(__SIMPLEHACKS_FIRST_SCALAR__(_arr)) (*)[ARRAY_TOTAL_ELEMENTS2(_arr)])&(_arr))
+
 #else
 
     /**
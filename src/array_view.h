@@ -0,0 +1,164 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef ARRAY_VIEW_H
+#define ARRAY_VIEW_H
+
+#include <stddef.h>
+#include <type_traits>
+
+// Views of fixed-size arrays, which keep the array's extent:
+//
+//     static_span<T, N> -- the extent is part of the type, so loops over the
+//                          whole span have a constant trip count (the
+//                          compiler can fully unroll and vectorize them),
+//                          and get<I>() is checked at compile time.
+//     array_view<T>     -- the extent is stored, for functions that accept
+//                          arrays of any size without a template parameter.
+//
+// Both are constructed only from an array (T (&)[N]), the same deduction that
+// ARRAY_SIZE2 uses, so passing a pointer fails to compile instead of silently
+// decaying.  Like built-in arrays, operator[] does not check its index.
+
+#if defined(__cplusplus) && (__cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900))
+
+namespace SimpleHacks {
+
+    template<typename T, size_t N>
+    class static_span
+    {
+        static_assert( N > 0, "zero-length arrays are not supported" );
+    public:
+        typedef T      element_type;
+        typedef T*     iterator;
+        static constexpr size_t extent = N;
+
+        constexpr static_span( T (&arr)[N] ) noexcept : m_data(arr) {}
+
+        // A span of T converts to a span of const T.  As with std::span, U (*)[]
+        // must convert to T (*)[], which rejects e.g. Derived to Base: indexing
+        // a Derived array in steps of sizeof(Base) would be undefined behavior.
+        template<typename U, typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type* = nullptr>
+        constexpr static_span( const static_span<U, N>& other ) noexcept : m_data(other.data()) {}
+
+        constexpr T*     data()  const noexcept { return m_data; }
+        static constexpr size_t size() noexcept { return N; }
+        constexpr T*     begin() const noexcept { return m_data; }
+        constexpr T*     end()   const noexcept { return m_data + N; }
+
+        constexpr T& operator[]( size_t index ) const noexcept { return m_data[index]; }
+
+        // Element at a compile-time index, which must be within the extent
+        template<size_t I>
+        constexpr T& get() const noexcept
+        {
+            static_assert( I < N, "index is out of range" );
+            return m_data[I];
+        }
+
+        // Count elements starting at Offset, which must be within the extent.
+        // The default Count does not wrap for Offset > N, so the static_assert reports it.
+        template<size_t Offset, size_t Count = (Offset <= N ? N - Offset : 0)>
+        constexpr static_span<T, Count> subspan() const noexcept
+        {
+            static_assert( Offset <= N && Count <= N - Offset, "subspan is out of range" );
+            return static_span<T, Count>(m_data + Offset, typename static_span<T, Count>::private_tag());
+        }
+
+        // Calls f(element) for each element, with a constant trip count
+        template<typename F>
+        void for_each( F&& f ) const
+        {
+            for (size_t i = 0; i < N; ++i) {
+                f(m_data[i]);
+            }
+        }
+
+    private:
+        template<typename, size_t> friend class static_span;
+        struct private_tag {};
+        constexpr static_span( T* data, private_tag ) noexcept : m_data(data) {}
+
+        T* m_data;
+    };
+
+    template<size_t I, typename T, size_t N>
+    constexpr T& get( const static_span<T, N>& span ) noexcept
+    {
+        return span.template get<I>();
+    }
+
+    template<typename T>
+    class array_view
+    {
+    public:
+        typedef T  element_type;
+        typedef T* iterator;
+
+        template<size_t N>
+        constexpr array_view( T (&arr)[N] ) noexcept : m_data(arr), m_size(N) {}
+
+        // same conversion rule as static_span's converting constructor
+        template<typename U, size_t N, typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type* = nullptr>
+        constexpr array_view( const static_span<U, N>& span ) noexcept : m_data(span.data()), m_size(N) {}
+
+        constexpr T*     data()  const noexcept { return m_data; }
+        constexpr size_t size()  const noexcept { return m_size; }
+        constexpr T*     begin() const noexcept { return m_data; }
+        constexpr T*     end()   const noexcept { return m_data + m_size; }
+
+        constexpr T& operator[]( size_t index ) const noexcept { return m_data[index]; }
+
+    private:
+        T*     m_data;
+        size_t m_size;
+    };
+
+    template<typename T, size_t N>
+    constexpr static_span<T, N> make_static_span( T (&arr)[N] ) noexcept
+    {
+        return static_span<T, N>(arr);
+    }
+
+    template<typename T, size_t N>
+    constexpr array_view<T> make_array_view( T (&arr)[N] ) noexcept
+    {
+        return array_view<T>(arr);
+    }
+
+#if __cpp_deduction_guides >= 201703L
+    template<typename T, size_t N> static_span( T (&)[N] ) -> static_span<T, N>;
+    template<typename T, size_t N> array_view( T (&)[N] ) -> array_view<T>;
+#endif
+
+} // namespace SimpleHacks
+
+#endif // C++11
+
+#endif // #ifndef ARRAY_VIEW_H
@@ -0,0 +1,255 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef ASCTIME_PARSE_H
+#define ASCTIME_PARSE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Parses timestamps in the fixed-width asctime() format, which is also the
+// format of the __TIMESTAMP__ macro used by compile_timestamp.h:
+//     "Sun Sep 16 01:03:52 1973"
+//      0....-....1....-....2...  -- indices to each character
+//
+// The scalar functions are constexpr, so the same code decodes string
+// literals at compile time and log records at runtime.  The batch functions
+// decode many fixed-width records, using SSSE3 / AVX2 when available.
+//
+// As with compile_timestamp.h, a timestamp that contains '?' (the compiler
+// could not determine it) decodes as "Mon Jan  1 00:00:00 1980", with the
+// failure flag set.  Other malformed input is not detected.
+
+#if __cpp_constexpr >= 201304
+    // avr gcc -- not supported (as of v 5.4.0)
+    // gcc   5.1.0 and higher, using -std=c++14
+    // clang 3.4.0 and higher, using -std=c++14
+    // msvc  19.10 and higher
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define __ASCTIME_PARSE_H_AVX2
+    #define __ASCTIME_PARSE_H_SSSE3
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__SSSE3__)
+    #include <tmmintrin.h>
+    #define __ASCTIME_PARSE_H_SSSE3
+#endif
+
+namespace SimpleHacks {
+
+    // Number of characters in an asctime() timestamp, excluding any newline or null
+    static constexpr size_t asctime_length = 24u;
+
+    struct asctime_fields
+    {
+        uint16_t year;     // e.g., 1973
+        uint8_t  month;    // 1..12
+        uint8_t  day;      // 1..31
+        uint8_t  hour;     // 0..23
+        uint8_t  minute;   // 0..59
+        uint8_t  seconds;  // 0..60
+        uint8_t  failure;  // non-zero if the timestamp contained '?'
+    };
+
+    // Month number (1..12) from the three-letter English month name.
+    // As in compile_date.h, only the 2nd and 3rd characters are examined.
+    // Their sum (mod 32) is unique for each month, so one table lookup
+    // replaces the chain of comparisons.  Returns 0 for an unknown name.
+    constexpr inline unsigned asctime_month( const char* name )
+    {
+        return (unsigned)
+            "\x00\x07\x04\x06\x00\x0b\x00\x02\x0c\x00\x00\x00\x00\x00\x00\x01"
+            "\x00\x00\x00\x03\x00\x09\x00\x0a\x00\x00\x05\x00\x08\x00\x00\x00"
+            [((unsigned char)name[1] + (unsigned char)name[2]) & 31u];
+    }
+
+    // Days since 1970-01-01 (days_from_civil() by Howard Hinnant), negative before 1970.
+    // The year is offset by 400 (146097 days) so the divisions never see a negative year.
+    constexpr inline int64_t asctime_days_from_civil( unsigned y, unsigned m, unsigned d )
+    {
+        return (int64_t)(  365ull * (y + 400u - (m <= 2u))
+                         +          (y + 400u - (m <= 2u)) /   4u
+                         -          (y + 400u - (m <= 2u)) / 100u
+                         +          (y + 400u - (m <= 2u)) / 400u
+                         + (153u * ((m + 9u) % 12u) + 2u) / 5u
+                         + d - 1u)
+               - 719468 - 146097;
+    }
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail {
+        // (c - '0') for a digit, and zero for the leading space of a single-digit day
+        constexpr inline unsigned asctime_digit( char c )
+        {
+            return (unsigned)(c == ' ' ? 0 : c - '0');
+        }
+    }
+
+    // Decodes one timestamp.  s must point to at least 24 characters.
+    constexpr inline asctime_fields parse_asctime( const char* s )
+    {
+        const bool failure =
+            (s[ 0] == '?') | (s[ 4] == '?') | (s[ 9] == '?') | (s[11] == '?') |
+            (s[14] == '?') | (s[17] == '?') | (s[20] == '?');
+        if (failure) {
+            return asctime_fields{ 1980u, 1u, 1u, 0u, 0u, 0u, 1u };
+        }
+        using _Detail::asctime_digit;
+        return asctime_fields{
+            (uint16_t)(asctime_digit(s[20]) * 1000u + asctime_digit(s[21]) * 100u +
+                       asctime_digit(s[22]) *   10u + asctime_digit(s[23])),
+            (uint8_t)asctime_month(s + 4),
+            (uint8_t)(asctime_digit(s[ 8]) * 10u + asctime_digit(s[ 9])),
+            (uint8_t)(asctime_digit(s[11]) * 10u + asctime_digit(s[12])),
+            (uint8_t)(asctime_digit(s[14]) * 10u + asctime_digit(s[15])),
+            (uint8_t)(asctime_digit(s[17]) * 10u + asctime_digit(s[18])),
+            0u
+            };
+    }
+
+    // Seconds since 1970-01-01T00:00:00, treating the fields as UTC.
+    // Signed, as with time_t: years before 1970 give negative values.
+    constexpr inline int64_t asctime_to_epoch( const asctime_fields& f )
+    {
+        return asctime_days_from_civil(f.year, f.month, f.day) * 86400
+             + f.hour * 3600 + f.minute * 60 + f.seconds;
+    }
+
+    constexpr inline int64_t parse_asctime_epoch( const char* s )
+    {
+        return asctime_to_epoch(parse_asctime(s));
+    }
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail {
+
+    #if defined(__ASCTIME_PARSE_H_SSSE3)
+        // Digits of characters [8, 24) of a timestamp, as pairs to be combined by maddubs:
+        //     day, hour, minute, seconds, year / 100, year % 100
+        inline __m128i asctime_pair_shuffle()
+        {
+            return _mm_setr_epi8(0, 1,  3, 4,  6, 7,  9, 10,  12, 13,  14, 15,  -1, -1, -1, -1);
+        }
+
+        // Combines the 16-bit lanes produced from asctime_pair_shuffle() into fields
+        inline asctime_fields asctime_from_lanes( const char* s, const int16_t* lanes, int question_marks )
+        {
+            if (question_marks | (s[0] == '?') | (s[4] == '?')) {
+                return asctime_fields{ 1980u, 1u, 1u, 0u, 0u, 0u, 1u };
+            }
+            asctime_fields f = {
+                (uint16_t)(lanes[4] * 100 + lanes[5]),
+                (uint8_t)asctime_month(s + 4),
+                (uint8_t)lanes[0],
+                (uint8_t)lanes[1],
+                (uint8_t)lanes[2],
+                (uint8_t)lanes[3],
+                0u
+                };
+            return f;
+        }
+
+        // One record per 128-bit vector.  Subtracting '0' with unsigned saturation
+        // turns the leading space of a single-digit day into zero.
+        inline asctime_fields parse_asctime_ssse3( const char* s )
+        {
+            const __m128i v      = _mm_loadu_si128((const __m128i*)(s + 8));
+            const __m128i digits = _mm_subs_epu8(v, _mm_set1_epi8('0'));
+            const __m128i pairs  = _mm_maddubs_epi16(_mm_shuffle_epi8(digits, asctime_pair_shuffle()), _mm_set1_epi16(0x010A));
+            int16_t lanes[8];
+            _mm_storeu_si128((__m128i*)lanes, pairs);
+            return asctime_from_lanes(s, lanes, _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('?'))));
+        }
+    #endif
+
+    #if defined(__ASCTIME_PARSE_H_AVX2)
+        // Two records per 256-bit vector (one per 128-bit lane), so four vectors
+        // decode eight records per iteration.
+        inline void parse_asctime_avx2_x2( const char* s0, const char* s1, asctime_fields* out )
+        {
+            const __m256i v      = _mm256_inserti128_si256(
+                                       _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(s0 + 8))),
+                                       _mm_loadu_si128((const __m128i*)(s1 + 8)), 1);
+            const __m256i digits = _mm256_subs_epu8(v, _mm256_set1_epi8('0'));
+            const __m256i shuf   = _mm256_broadcastsi128_si256(asctime_pair_shuffle());
+            const __m256i pairs  = _mm256_maddubs_epi16(_mm256_shuffle_epi8(digits, shuf), _mm256_set1_epi16(0x010A));
+            const uint32_t qmask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('?')));
+            int16_t lanes[16];
+            _mm256_storeu_si256((__m256i*)lanes, pairs);
+            out[0] = asctime_from_lanes(s0, lanes,     (int)(qmask & 0xFFFFu));
+            out[1] = asctime_from_lanes(s1, lanes + 8, (int)(qmask >> 16u));
+        }
+    #endif
+
+    } // namespace _Detail
+
+    // Decodes count fixed-width records.  Record i starts at records + i * stride,
+    // e.g., stride 25 for newline-separated asctime() lines.  stride must be >= 24.
+    inline void parse_asctime_batch( const char* records, size_t stride, size_t count, asctime_fields* out )
+    {
+        size_t i = 0;
+    #if defined(__ASCTIME_PARSE_H_AVX2)
+        for (; i + 8u <= count; i += 8u) {
+            const char* s = records + i * stride;
+            _Detail::parse_asctime_avx2_x2(s             , s +     stride, out + i     );
+            _Detail::parse_asctime_avx2_x2(s + 2 * stride, s + 3 * stride, out + i + 2u);
+            _Detail::parse_asctime_avx2_x2(s + 4 * stride, s + 5 * stride, out + i + 4u);
+            _Detail::parse_asctime_avx2_x2(s + 6 * stride, s + 7 * stride, out + i + 6u);
+        }
+    #endif
+        for (; i < count; ++i) {
+    #if defined(__ASCTIME_PARSE_H_SSSE3)
+            out[i] = _Detail::parse_asctime_ssse3(records + i * stride);
+    #else
+            out[i] = parse_asctime(records + i * stride);
+    #endif
+        }
+    }
+
+    // As parse_asctime_batch(), but writes seconds since 1970-01-01 (as UTC), as asctime_to_epoch()
+    inline void parse_asctime_epoch_batch( const char* records, size_t stride, size_t count, int64_t* out )
+    {
+        asctime_fields fields[64];
+        while (count != 0) {
+            const size_t n = (count < 64u) ? count : 64u;
+            parse_asctime_batch(records, stride, n, fields);
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = asctime_to_epoch(fields[i]);
+            }
+            records += n * stride;
+            out     += n;
+            count   -= n;
+        }
+    }
+
+} // namespace SimpleHacks
+
+#endif // __cpp_constexpr >= 201304
+
+#endif // #ifndef ASCTIME_PARSE_H
@@ -30,6 +30,19 @@ SOFTWARE.
 #ifndef COMPILE_DATE_H
 #define COMPILE_DATE_H
 
+/**
+    The following, if defined prior to inclusion of this header file,
+    will modify its behavior as noted:
+
+        COMPILE_DATE_SOURCE_DATE_EPOCH
+        -- if defined as an integer number of seconds since 1970-01-01 (UTC),
+           e.g., -DCOMPILE_DATE_SOURCE_DATE_EPOCH=$SOURCE_DATE_EPOCH, all the
+           macros below decode that value instead of __DATE__ and __TIME__.
+           Every translation unit then sees the same date, and the output
+           no longer changes with the wall clock (reproducible builds, and
+           compiler caches such as ccache can hit).
+ */
+
 // see https://godbolt.org/z/3dSuqQ
 
 #ifndef __has_feature
@@ -44,6 +57,33 @@ SOFTWARE.
     #define __COMPILE_DATE_H_CONSTEXPR
 #endif    
 
+#if defined(COMPILE_DATE_SOURCE_DATE_EPOCH)
+
+// civil_from_days() by Howard Hinnant, as integer constant expressions.
+// The year is considered to start on March 1st (mp == 0), so the leap day
+// is the last day of the year.
+#define __COMPILE_DATE_H_SDE_Z   ( (COMPILE_DATE_SOURCE_DATE_EPOCH) / 86400ull + 719468ull )
+#define __COMPILE_DATE_H_SDE_ERA ( __COMPILE_DATE_H_SDE_Z / 146097ull )
+#define __COMPILE_DATE_H_SDE_DOE ( __COMPILE_DATE_H_SDE_Z - __COMPILE_DATE_H_SDE_ERA * 146097ull )
+#define __COMPILE_DATE_H_SDE_YOE ( \
+   ( __COMPILE_DATE_H_SDE_DOE          \
+   - __COMPILE_DATE_H_SDE_DOE /   1460u \
+   + __COMPILE_DATE_H_SDE_DOE /  36524u \
+   - __COMPILE_DATE_H_SDE_DOE / 146096u ) / 365u )
+#define __COMPILE_DATE_H_SDE_DOY ( __COMPILE_DATE_H_SDE_DOE - \
+   (365u * __COMPILE_DATE_H_SDE_YOE + __COMPILE_DATE_H_SDE_YOE / 4u - __COMPILE_DATE_H_SDE_YOE / 100u) )
+#define __COMPILE_DATE_H_SDE_MP  ( (5u * __COMPILE_DATE_H_SDE_DOY + 2u) / 153u )
+#define __COMPILE_DATE_H_SDE_SOD ( (COMPILE_DATE_SOURCE_DATE_EPOCH) % 86400ull )
+
+#define __DATE_YEAR_INT__    ( (unsigned)(__COMPILE_DATE_H_SDE_YOE + __COMPILE_DATE_H_SDE_ERA * 400u + (__COMPILE_DATE_H_SDE_MP >= 10u)) )
+#define __DATE_MONTH_INT__   ( (unsigned)(__COMPILE_DATE_H_SDE_MP < 10u ? __COMPILE_DATE_H_SDE_MP + 3u : __COMPILE_DATE_H_SDE_MP - 9u) )
+#define __DATE_DAY_INT__     ( (unsigned)(__COMPILE_DATE_H_SDE_DOY - (153u * __COMPILE_DATE_H_SDE_MP + 2u) / 5u + 1u) )
+#define __TIME_HOUR_INT__    ( (unsigned)(__COMPILE_DATE_H_SDE_SOD / 3600u) )
+#define __TIME_MINUTE_INT__  ( (unsigned)(__COMPILE_DATE_H_SDE_SOD / 60u % 60u) )
+#define __TIME_SECONDS_INT__ ( (unsigned)(__COMPILE_DATE_H_SDE_SOD % 60u) )
+
+#else
+
 #define __DATE_YEAR_INT__ ((( \
   (__DATE__ [ 7u] - '0')  * 10u + \
   (__DATE__ [ 8u] - '0')) * 10u + \
@@ -83,6 +123,8 @@ SOFTWARE.
  + (__TIME__ [7u] == '?' ? 0u : __TIME__ [7u] - '0')       )
 
 
+#endif // COMPILE_DATE_SOURCE_DATE_EPOCH
+
 #define __DATE_MSDOS_INT__             ( \
   ((__DATE_YEAR_INT__  - 1980u) << 9u) | \
   ( __DATE_MONTH_INT__          << 5u) | \
@@ -91,46 +133,131 @@ SOFTWARE.
 #define __TIME_MSDOS_INT__         ( \
   ( __TIME_HOUR_INT__      << 11u) | \
   ( __TIME_MINUTE_INT__    <<  5u) | \
-  ( __TIME_SECONDS_INT__   <<  0u) )
+  ( __TIME_SECONDS_INT__   >>  1u) ) /* two-second resolution */
+
+// Days since 1970-01-01 for a (proleptic Gregorian) date, for years >= 1970.
+// This is the days_from_civil() algorithm by Howard Hinnant, where the year
+// is considered to start on March 1st, so the leap day is the last day of the year.
+#define __COMPILE_DATE_H_DAYS_FROM_CIVIL(y, m, d)           ( \
+    365ull * ((y) - ((m) <= 2u))                              \
+  +          ((y) - ((m) <= 2u)) /   4u                       \
+  -          ((y) - ((m) <= 2u)) / 100u                       \
+  +          ((y) - ((m) <= 2u)) / 400u                       \
+  + (153u * (((m) + 9u) % 12u) + 2u) / 5u                     \
+  + (d) - 1u                                                  \
+  - 719468ull                                                 )
+
+// Seconds since 1970-01-01T00:00:00, treating __DATE__ / __TIME__ as UTC
+#define __DATE_UNIX_EPOCH__                                                                \
+  ( __COMPILE_DATE_H_DAYS_FROM_CIVIL(__DATE_YEAR_INT__, __DATE_MONTH_INT__, __DATE_DAY_INT__) * 86400ull \
+  + __TIME_HOUR_INT__   * 3600ull                                                           \
+  + __TIME_MINUTE_INT__ *   60ull                                                           \
+  + __TIME_SECONDS_INT__                                                                    )
+
+// 64-bit integer whose decimal digits are YYYYMMDDhhmmss, e.g., 20221225034817.
+// Sorts in the same order as the date/time, and remains human-readable.
+#define __DATE_PACKED_INT__                       ( \
+    __DATE_YEAR_INT__    * 10000000000ull           \
+  + __DATE_MONTH_INT__   *   100000000ull           \
+  + __DATE_DAY_INT__     *     1000000ull           \
+  + __TIME_HOUR_INT__    *       10000ull           \
+  + __TIME_MINUTE_INT__  *         100ull           \
+  + __TIME_SECONDS_INT__                            )
+
+// The characters of the ISO8601 strings below, without the terminating null
+#define __COMPILE_DATE_H_ISO8601_DATE_CHARS \
+    (char)(( (__DATE_YEAR_INT__    / 1000) % 10 ) + '0'), \
+    (char)(( (__DATE_YEAR_INT__    /  100) % 10 ) + '0'), \
+    (char)(( (__DATE_YEAR_INT__    /   10) % 10 ) + '0'), \
+    (char)(( (__DATE_YEAR_INT__    /    1) % 10 ) + '0'), \
+    '-', \
+    (char)(( (__DATE_MONTH_INT__   /   10) % 10 ) + '0'), \
+    (char)(( (__DATE_MONTH_INT__   /    1) % 10 ) + '0'), \
+    '-', \
+    (char)(( (__DATE_DAY_INT__     /   10) % 10 ) + '0'), \
+    (char)(( (__DATE_DAY_INT__     /    1) % 10 ) + '0')
+#define __COMPILE_DATE_H_ISO8601_TIME_CHARS \
+    (char)(( (__TIME_HOUR_INT__    /   10) % 10 ) + '0'), \
+    (char)(( (__TIME_HOUR_INT__    /    1) % 10 ) + '0'), \
+    ':', \
+    (char)(( (__TIME_MINUTE_INT__  /   10) % 10 ) + '0'), \
+    (char)(( (__TIME_MINUTE_INT__  /    1) % 10 ) + '0'), \
+    ':', \
+    (char)(( (__TIME_SECONDS_INT__ /   10) % 10 ) + '0'), \
+    (char)(( (__TIME_SECONDS_INT__ /    1) % 10 ) + '0')
 
 __COMPILE_DATE_H_CONSTEXPR
 static const char __DATE_ISO8601_DATE__[] =
 {
-    (char)(( (__DATE_YEAR_INT__    / 1000) % 10 ) + '0'),
-    (char)(( (__DATE_YEAR_INT__    /  100) % 10 ) + '0'),
-    (char)(( (__DATE_YEAR_INT__    /   10) % 10 ) + '0'),
-    (char)(( (__DATE_YEAR_INT__    /    1) % 10 ) + '0'),
-    '-',
-    (char)(( (__DATE_MONTH_INT__   /   10) % 10 ) + '0'),
-    (char)(( (__DATE_MONTH_INT__   /    1) % 10 ) + '0'),
-    '-',
-    (char)(( (__DATE_DAY_INT__     /   10) % 10 ) + '0'),
-    (char)(( (__DATE_DAY_INT__     /    1) % 10 ) + '0'),
+    __COMPILE_DATE_H_ISO8601_DATE_CHARS,
     '\0'
 };
 
 __COMPILE_DATE_H_CONSTEXPR
-const char __DATE_ISO8601_DATETIME__[] =
+static const char __DATE_ISO8601_DATETIME__[] =
 {
-    (char)(( (__DATE_YEAR_INT__    / 1000) % 10 ) + '0'),
-    (char)(( (__DATE_YEAR_INT__    /  100) % 10 ) + '0'),
-    (char)(( (__DATE_YEAR_INT__    /   10) % 10 ) + '0'),
-    (char)(( (__DATE_YEAR_INT__    /    1) % 10 ) + '0'),
-    '-',
-    (char)(( (__DATE_MONTH_INT__   /   10) % 10 ) + '0'),
-    (char)(( (__DATE_MONTH_INT__   /    1) % 10 ) + '0'),
-    '-',
-    (char)(( (__DATE_DAY_INT__     /   10) % 10 ) + '0'),
-    (char)(( (__DATE_DAY_INT__     /    1) % 10 ) + '0'),
+    __COMPILE_DATE_H_ISO8601_DATE_CHARS,
     'T',
-    (char)(( (__TIME_HOUR_INT__    /   10) % 10 ) + '0'),
-    (char)(( (__TIME_HOUR_INT__    /    1) % 10 ) + '0'),
-    ':',
-    (char)(( (__TIME_MINUTE_INT__  /   10) % 10 ) + '0'),
-    (char)(( (__TIME_MINUTE_INT__  /    1) % 10 ) + '0'),
-    ':',
-    (char)(( (__TIME_SECONDS_INT__ /   10) % 10 ) + '0'),
-    (char)(( (__TIME_SECONDS_INT__ /    1) % 10 ) + '0'),
+    __COMPILE_DATE_H_ISO8601_TIME_CHARS,
     '\0'
 };
+
+// All of the above in one object, with a single definition shared by every
+// translation unit (C++17 inline variable, or a selectany / weak symbol),
+// rather than one copy of each string per translation unit.
+typedef struct compile_date_info_t
+{
+    unsigned           year;
+    unsigned           month;
+    unsigned           day;
+    unsigned           hour;
+    unsigned           minute;
+    unsigned           seconds;
+    unsigned short     msdos_date;
+    unsigned short     msdos_time;
+    unsigned long long unix_epoch;
+    unsigned long long packed;
+    char               iso8601_date[11];
+    char               iso8601_datetime[20];
+} compile_date_info_t;
+
+// Without COMPILE_DATE_SOURCE_DATE_EPOCH, __DATE__ / __TIME__ can differ between
+// translation units, so the definitions differ too.  An inline constexpr
+// variable would then violate the ODR, and each translation unit would fold
+// its own value, so it is only used when every definition is identical.
+// Otherwise, the selectany / weak object is not constexpr, and is read from
+// the single definition the linker keeps.
+#if defined(__cplusplus) && __cpp_inline_variables >= 201606L && defined(COMPILE_DATE_SOURCE_DATE_EPOCH)
+    #define __COMPILE_DATE_H_SINGLE_DEFINITION inline __COMPILE_DATE_H_CONSTEXPR
+#elif defined(__cplusplus) && defined(_MSC_VER) && defined(COMPILE_DATE_SOURCE_DATE_EPOCH)
+    #define __COMPILE_DATE_H_SINGLE_DEFINITION extern __declspec(selectany) __COMPILE_DATE_H_CONSTEXPR const
+#elif defined(__cplusplus) && defined(_MSC_VER)
+    #define __COMPILE_DATE_H_SINGLE_DEFINITION extern __declspec(selectany) const
+#elif defined(__cplusplus) && (defined(__GNUC__) || defined(__clang__))
+    #define __COMPILE_DATE_H_SINGLE_DEFINITION extern __attribute__((weak)) const
+#elif defined(_MSC_VER)
+    #define __COMPILE_DATE_H_SINGLE_DEFINITION __declspec(selectany) const
+#elif defined(__GNUC__) || defined(__clang__)
+    #define __COMPILE_DATE_H_SINGLE_DEFINITION __attribute__((weak)) const
+#else
+    #define __COMPILE_DATE_H_SINGLE_DEFINITION static const // one copy per translation unit
+#endif
+
+__COMPILE_DATE_H_SINGLE_DEFINITION
+compile_date_info_t compile_date_info =
+{
+    __DATE_YEAR_INT__,
+    __DATE_MONTH_INT__,
+    __DATE_DAY_INT__,
+    __TIME_HOUR_INT__,
+    __TIME_MINUTE_INT__,
+    __TIME_SECONDS_INT__,
+    (unsigned short)(__DATE_MSDOS_INT__),
+    (unsigned short)(__TIME_MSDOS_INT__),
+    __DATE_UNIX_EPOCH__,
+    __DATE_PACKED_INT__,
+    { __COMPILE_DATE_H_ISO8601_DATE_CHARS, '\0' },
+    { __COMPILE_DATE_H_ISO8601_DATE_CHARS, 'T', __COMPILE_DATE_H_ISO8601_TIME_CHARS, '\0' }
+};
+
 #endif // COMPILE_DATE_H
@@ -33,6 +33,18 @@ SOFTWARE.
 #ifndef COMPILE_TIMESTAMP_H
 #define COMPILE_TIMESTAMP_H
 
+/**
+    The following, if defined prior to inclusion of this header file,
+    will modify its behavior as noted:
+
+        COMPILE_TIMESTAMP_SOURCE_DATE_EPOCH
+        -- if defined as an integer number of seconds since 1970-01-01 (UTC),
+           e.g., -DCOMPILE_TIMESTAMP_SOURCE_DATE_EPOCH=$SOURCE_DATE_EPOCH, all
+           the macros below decode that value instead of __TIMESTAMP__.  The
+           output then no longer depends on when each file was checked out
+           or edited (reproducible builds, and compiler caches can hit).
+ */
+
 #ifndef __has_feature
     #define __has_feature(x) 0 // Compatibility with non-clang compilers.
 #endif
@@ -54,32 +66,128 @@ SOFTWARE.
 // also supports DOS date & time (e.g., for FAT structures), chose the following:
 //     "Mon Jan  1 00:00:00 1980" -- What the macros effectively return on error
 
+// The failure check and parsing are written twice:
+// * C++11 and later:  Each macro expands to a single call of a constexpr function,
+//                     which parses __TIMESTAMP__ (including the failure check).
+//                     This keeps each use of a macro to a handful of tokens.
+// * Otherwise (e.g., C):  Each macro expands to an expression over the characters
+//                     of __TIMESTAMP__.  Compilers report either a valid timestamp,
+//                     or one that is entirely '?', so the failure check only needs
+//                     the first character of each field.
+// In both cases, __TIMESTAMP__ is expanded where the macro is used, so the
+// values correspond to the file using the macro.
+// With COMPILE_TIMESTAMP_SOURCE_DATE_EPOCH defined, neither is used.
+
+#if defined(COMPILE_TIMESTAMP_SOURCE_DATE_EPOCH)
+
+// civil_from_days() by Howard Hinnant, as integer constant expressions.
+// The year is considered to start on March 1st (mp == 0), so the leap day
+// is the last day of the year.
+#define __COMPILE_TIMESTAMP_H_SDE_Z   ( (COMPILE_TIMESTAMP_SOURCE_DATE_EPOCH) / 86400ull + 719468ull )
+#define __COMPILE_TIMESTAMP_H_SDE_ERA ( __COMPILE_TIMESTAMP_H_SDE_Z / 146097ull )
+#define __COMPILE_TIMESTAMP_H_SDE_DOE ( __COMPILE_TIMESTAMP_H_SDE_Z - __COMPILE_TIMESTAMP_H_SDE_ERA * 146097ull )
+#define __COMPILE_TIMESTAMP_H_SDE_YOE ( \
+   ( __COMPILE_TIMESTAMP_H_SDE_DOE          \
+   - __COMPILE_TIMESTAMP_H_SDE_DOE /   1460u \
+   + __COMPILE_TIMESTAMP_H_SDE_DOE /  36524u \
+   - __COMPILE_TIMESTAMP_H_SDE_DOE / 146096u ) / 365u )
+#define __COMPILE_TIMESTAMP_H_SDE_DOY ( __COMPILE_TIMESTAMP_H_SDE_DOE - \
+   (365u * __COMPILE_TIMESTAMP_H_SDE_YOE + __COMPILE_TIMESTAMP_H_SDE_YOE / 4u - __COMPILE_TIMESTAMP_H_SDE_YOE / 100u) )
+#define __COMPILE_TIMESTAMP_H_SDE_MP  ( (5u * __COMPILE_TIMESTAMP_H_SDE_DOY + 2u) / 153u )
+#define __COMPILE_TIMESTAMP_H_SDE_SOD ( (COMPILE_TIMESTAMP_SOURCE_DATE_EPOCH) % 86400ull )
+
+#define __TIMESTAMP_FAILURE__        ( 0 )
+#define __TIMESTAMP_YEAR_INT__       ( (unsigned)(__COMPILE_TIMESTAMP_H_SDE_YOE + __COMPILE_TIMESTAMP_H_SDE_ERA * 400u + (__COMPILE_TIMESTAMP_H_SDE_MP >= 10u)) )
+#define __TIMESTAMP_MONTH_INT__      ( (unsigned)(__COMPILE_TIMESTAMP_H_SDE_MP < 10u ? __COMPILE_TIMESTAMP_H_SDE_MP + 3u : __COMPILE_TIMESTAMP_H_SDE_MP - 9u) )
+#define __TIMESTAMP_DAY_INT__        ( (unsigned)(__COMPILE_TIMESTAMP_H_SDE_DOY - (153u * __COMPILE_TIMESTAMP_H_SDE_MP + 2u) / 5u + 1u) )
+#define __TIMESTAMP_HOUR_INT__       ( (unsigned)(__COMPILE_TIMESTAMP_H_SDE_SOD / 3600u) )
+#define __TIMESTAMP_MINUTE_INT__     ( (unsigned)(__COMPILE_TIMESTAMP_H_SDE_SOD / 60u % 60u) )
+#define __TIMESTAMP_SECONDS_INT__    ( (unsigned)(__COMPILE_TIMESTAMP_H_SDE_SOD % 60u) )
+
+#elif defined(__cplusplus) && (__cpp_constexpr >= 200704  || __has_feature(cxx_constexpr))
+
+namespace SimpleHacks {
+namespace _Detail {
+
+    struct compile_timestamp_fields
+    {
+        unsigned year;
+        unsigned month;
+        unsigned day;
+        unsigned hour;
+        unsigned minute;
+        unsigned seconds;
+        bool     failure;
+    };
+
+    constexpr inline bool compile_timestamp_failed( const char (&ts)[25], unsigned i = 0u )
+    {
+        return (i == 24u) ? false : (ts[i] == '?') ? true : compile_timestamp_failed(ts, i + 1u);
+    }
+
+    constexpr inline unsigned compile_timestamp_2digits( char tens, char ones )
+    {
+        return (tens == ' ' ? 0u : (unsigned)(tens - '0')) * 10u + (unsigned)(ones - '0');
+    }
+
+    constexpr inline unsigned compile_timestamp_month( const char (&ts)[25] )
+    {
+        return
+          (ts[6u] == 'n' && ts[5u] == 'a') ?  1u  /*Jan*/
+        : (ts[6u] == 'b'                 ) ?  2u  /*Feb*/
+        : (ts[6u] == 'r' && ts[5u] == 'a') ?  3u  /*Mar*/
+        : (ts[6u] == 'r'                 ) ?  4u  /*Apr*/
+        : (ts[6u] == 'y'                 ) ?  5u  /*May*/
+        : (ts[6u] == 'n'                 ) ?  6u  /*Jun*/
+        : (ts[6u] == 'l'                 ) ?  7u  /*Jul*/
+        : (ts[6u] == 'g'                 ) ?  8u  /*Aug*/
+        : (ts[6u] == 'p'                 ) ?  9u  /*Sep*/
+        : (ts[6u] == 't'                 ) ? 10u  /*Oct*/
+        : (ts[6u] == 'v'                 ) ? 11u  /*Nov*/
+        :                                    12u  /*Dec*/ ;
+    }
+
+    constexpr inline compile_timestamp_fields compile_timestamp_parse( const char (&ts)[25], bool failure )
+    {
+        return failure ?
+            compile_timestamp_fields{ 1980u, 1u, 1u, 0u, 0u, 0u, true } :
+            compile_timestamp_fields{
+                compile_timestamp_2digits(ts[20u], ts[21u]) * 100u + compile_timestamp_2digits(ts[22u], ts[23u]),
+                compile_timestamp_month(ts),
+                compile_timestamp_2digits(ts[ 8u], ts[ 9u]),
+                compile_timestamp_2digits(ts[11u], ts[12u]),
+                compile_timestamp_2digits(ts[14u], ts[15u]),
+                compile_timestamp_2digits(ts[17u], ts[18u]),
+                false
+                };
+    }
+
+    constexpr inline compile_timestamp_fields compile_timestamp_parse( const char (&ts)[25] )
+    {
+        return compile_timestamp_parse(ts, compile_timestamp_failed(ts));
+    }
+
+} // namespace _Detail
+} // namespace SimpleHacks
+
+#define __TIMESTAMP_FAILURE__        ( SimpleHacks::_Detail::compile_timestamp_parse(__TIMESTAMP__).failure ? 1 : 0 )
+#define __TIMESTAMP_YEAR_INT__       ( SimpleHacks::_Detail::compile_timestamp_parse(__TIMESTAMP__).year    )
+#define __TIMESTAMP_MONTH_INT__      ( SimpleHacks::_Detail::compile_timestamp_parse(__TIMESTAMP__).month   )
+#define __TIMESTAMP_DAY_INT__        ( SimpleHacks::_Detail::compile_timestamp_parse(__TIMESTAMP__).day     )
+#define __TIMESTAMP_HOUR_INT__       ( SimpleHacks::_Detail::compile_timestamp_parse(__TIMESTAMP__).hour    )
+#define __TIMESTAMP_MINUTE_INT__     ( SimpleHacks::_Detail::compile_timestamp_parse(__TIMESTAMP__).minute  )
+#define __TIMESTAMP_SECONDS_INT__    ( SimpleHacks::_Detail::compile_timestamp_parse(__TIMESTAMP__).seconds )
+
+#else
+
 #define __TIMESTAMP_FAILURE__ ( \
-  (__TIMESTAMP__ [ 0u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 1u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 2u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 3u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 4u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 5u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 6u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 7u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 8u] == '?') ? 1 : \
-  (__TIMESTAMP__ [ 9u] == '?') ? 1 : \
-  (__TIMESTAMP__ [10u] == '?') ? 1 : \
-  (__TIMESTAMP__ [11u] == '?') ? 1 : \
-  (__TIMESTAMP__ [12u] == '?') ? 1 : \
-  (__TIMESTAMP__ [13u] == '?') ? 1 : \
-  (__TIMESTAMP__ [14u] == '?') ? 1 : \
-  (__TIMESTAMP__ [15u] == '?') ? 1 : \
-  (__TIMESTAMP__ [16u] == '?') ? 1 : \
-  (__TIMESTAMP__ [17u] == '?') ? 1 : \
-  (__TIMESTAMP__ [18u] == '?') ? 1 : \
-  (__TIMESTAMP__ [19u] == '?') ? 1 : \
-  (__TIMESTAMP__ [20u] == '?') ? 1 : \
-  (__TIMESTAMP__ [21u] == '?') ? 1 : \
-  (__TIMESTAMP__ [22u] == '?') ? 1 : \
-  (__TIMESTAMP__ [23u] == '?') ? 1 : \
-  0 )
+  (__TIMESTAMP__ [ 0u] == '?') || /* weekday */ \
+  (__TIMESTAMP__ [ 4u] == '?') || /* month   */ \
+  (__TIMESTAMP__ [ 9u] == '?') || /* day     */ \
+  (__TIMESTAMP__ [11u] == '?') || /* hour    */ \
+  (__TIMESTAMP__ [14u] == '?') || /* minute  */ \
+  (__TIMESTAMP__ [17u] == '?') || /* second  */ \
+  (__TIMESTAMP__ [20u] == '?')    /* year    */ )
 #define __TIMESTAMP_YEAR_IMPL__ ((( \
   (__TIMESTAMP__ [20u] - '0')  * 10u + \
   (__TIMESTAMP__ [21u] - '0')) * 10u + \
@@ -110,14 +218,6 @@ SOFTWARE.
 #define __TIMESTAMP_SECONDS_IMPL__ (( \
    (__TIMESTAMP__ [17u] - '0') * 10u) + \
    (__TIMESTAMP__ [18u] - '0')          )
-#define __TIMESTAMP_MSDOS_DATE_IMPL__       ( \
-  ((__TIMESTAMP_YEAR_INT__  - 1980u) << 9u) | \
-  ( __TIMESTAMP_MONTH_INT__          << 5u) | \
-  ( __TIMESTAMP_DAY_INT__            << 0u) )
-#define __TIMESTAMP_MSDOS_TIME_IMPL__   ( \
-  ( __TIMESTAMP_HOUR_INT__      << 11u) | \
-  ( __TIMESTAMP_MINUTE_INT__    <<  5u) | \
-  ( __TIMESTAMP_SECONDS_INT__   <<  0u) )
 
 // And the resulting usable macros....
 #define __TIMESTAMP_YEAR_INT__       ( __TIMESTAMP_FAILURE__ ? 1980u : __TIMESTAMP_YEAR_IMPL__    )
@@ -127,47 +227,144 @@ SOFTWARE.
 #define __TIMESTAMP_MINUTE_INT__     ( __TIMESTAMP_FAILURE__ ?    0u : __TIMESTAMP_MINUTE_IMPL__  )
 #define __TIMESTAMP_SECONDS_INT__    ( __TIMESTAMP_FAILURE__ ?    0u : __TIMESTAMP_SECONDS_IMPL__ )
 
+#endif
+
+#define __TIMESTAMP_MSDOS_DATE_IMPL__       ( \
+  ((__TIMESTAMP_YEAR_INT__  - 1980u) << 9u) | \
+  ( __TIMESTAMP_MONTH_INT__          << 5u) | \
+  ( __TIMESTAMP_DAY_INT__            << 0u) )
+#define __TIMESTAMP_MSDOS_TIME_IMPL__   ( \
+  ( __TIMESTAMP_HOUR_INT__      << 11u) | \
+  ( __TIMESTAMP_MINUTE_INT__    <<  5u) | \
+  ( __TIMESTAMP_SECONDS_INT__   >>  1u) ) /* two-second resolution */
+
 #define __TIMESTAMP_MSDOS_DATE_INT__ ( __TIMESTAMP_MSDOS_DATE_IMPL__ )
 #define __TIMESTAMP_MSDOS_TIME_INT__ ( __TIMESTAMP_MSDOS_TIME_IMPL__ )
 
+// Days since 1970-01-01 for a (proleptic Gregorian) date, for years >= 1970.
+// This is the days_from_civil() algorithm by Howard Hinnant, where the year
+// is considered to start on March 1st, so the leap day is the last day of the year.
+#define __COMPILE_TIMESTAMP_H_DAYS_FROM_CIVIL(y, m, d)      ( \
+    365ull * ((y) - ((m) <= 2u))                              \
+  +          ((y) - ((m) <= 2u)) /   4u                       \
+  -          ((y) - ((m) <= 2u)) / 100u                       \
+  +          ((y) - ((m) <= 2u)) / 400u                       \
+  + (153u * (((m) + 9u) % 12u) + 2u) / 5u                     \
+  + (d) - 1u                                                  \
+  - 719468ull                                                 )
+
+// Seconds since 1970-01-01T00:00:00, treating __TIMESTAMP__ as UTC
+// (on error, 315532800, which is 1980-01-01T00:00:00)
+#define __TIMESTAMP_UNIX_EPOCH__                                                                          \
+  ( __COMPILE_TIMESTAMP_H_DAYS_FROM_CIVIL(__TIMESTAMP_YEAR_INT__, __TIMESTAMP_MONTH_INT__, __TIMESTAMP_DAY_INT__) * 86400ull \
+  + __TIMESTAMP_HOUR_INT__    * 3600ull                                                                    \
+  + __TIMESTAMP_MINUTE_INT__  *   60ull                                                                    \
+  + __TIMESTAMP_SECONDS_INT__                                                                              )
+
+// 64-bit integer whose decimal digits are YYYYMMDDhhmmss, e.g., 20221225034817.
+// Sorts in the same order as the date/time, and remains human-readable.
+#define __TIMESTAMP_PACKED_INT__                  ( \
+    __TIMESTAMP_YEAR_INT__    * 10000000000ull      \
+  + __TIMESTAMP_MONTH_INT__   *   100000000ull      \
+  + __TIMESTAMP_DAY_INT__     *     1000000ull      \
+  + __TIMESTAMP_HOUR_INT__    *       10000ull      \
+  + __TIMESTAMP_MINUTE_INT__  *         100ull      \
+  + __TIMESTAMP_SECONDS_INT__                       )
+
+// The characters of the ISO8601 strings below, without the terminating null
+#define __COMPILE_TIMESTAMP_H_ISO8601_DATE_CHARS \
+    (char)(( (__TIMESTAMP_YEAR_INT__    / 1000) % 10 ) + '0'), \
+    (char)(( (__TIMESTAMP_YEAR_INT__    /  100) % 10 ) + '0'), \
+    (char)(( (__TIMESTAMP_YEAR_INT__    /   10) % 10 ) + '0'), \
+    (char)(( (__TIMESTAMP_YEAR_INT__    /    1) % 10 ) + '0'), \
+    '-', \
+    (char)(( (__TIMESTAMP_MONTH_INT__   /   10) % 10 ) + '0'), \
+    (char)(( (__TIMESTAMP_MONTH_INT__   /    1) % 10 ) + '0'), \
+    '-', \
+    (char)(( (__TIMESTAMP_DAY_INT__     /   10) % 10 ) + '0'), \
+    (char)(( (__TIMESTAMP_DAY_INT__     /    1) % 10 ) + '0')
+#define __COMPILE_TIMESTAMP_H_ISO8601_TIME_CHARS \
+    (char)(( (__TIMESTAMP_HOUR_INT__    /   10) % 10 ) + '0'), \
+    (char)(( (__TIMESTAMP_HOUR_INT__    /    1) % 10 ) + '0'), \
+    ':', \
+    (char)(( (__TIMESTAMP_MINUTE_INT__  /   10) % 10 ) + '0'), \
+    (char)(( (__TIMESTAMP_MINUTE_INT__  /    1) % 10 ) + '0'), \
+    ':', \
+    (char)(( (__TIMESTAMP_SECONDS_INT__ /   10) % 10 ) + '0'), \
+    (char)(( (__TIMESTAMP_SECONDS_INT__ /    1) % 10 ) + '0')
+
 __COMPILE_TIMESTAMP_H_CONSTEXPR
 static const char __TIMESTAMP_ISO8601_DATE__[] =
 {
-    __TIMESTAMP_FAILURE__ ? '1' : (char)(( (__TIMESTAMP_YEAR_INT__    / 1000) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '9' : (char)(( (__TIMESTAMP_YEAR_INT__    /  100) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_YEAR_INT__    /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_YEAR_INT__    /    1) % 10 ) + '0'),
-    '-',
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_MONTH_INT__   /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_MONTH_INT__   /    1) % 10 ) + '0'),
-    '-',
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_DAY_INT__     /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_DAY_INT__     /    1) % 10 ) + '0'),
+    __COMPILE_TIMESTAMP_H_ISO8601_DATE_CHARS,
     '\0'
 };
 
 __COMPILE_TIMESTAMP_H_CONSTEXPR
-const char __TIMESTAMP_ISO8601_DATETIME__[] =
+static const char __TIMESTAMP_ISO8601_DATETIME__[] =
 {
-    __TIMESTAMP_FAILURE__ ? '1' : (char)(( (__TIMESTAMP_YEAR_INT__    / 1000) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '9' : (char)(( (__TIMESTAMP_YEAR_INT__    /  100) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_YEAR_INT__    /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_YEAR_INT__    /    1) % 10 ) + '0'),
-    '-',
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_MONTH_INT__   /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_MONTH_INT__   /    1) % 10 ) + '0'),
-    '-',
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_DAY_INT__     /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_DAY_INT__     /    1) % 10 ) + '0'),
+    __COMPILE_TIMESTAMP_H_ISO8601_DATE_CHARS,
     'T',
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_HOUR_INT__    /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_HOUR_INT__    /    1) % 10 ) + '0'),
-    ':',
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_MINUTE_INT__  /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_MINUTE_INT__  /    1) % 10 ) + '0'),
-    ':',
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_SECONDS_INT__ /   10) % 10 ) + '0'),
-    __TIMESTAMP_FAILURE__ ? '0' : (char)(( (__TIMESTAMP_SECONDS_INT__ /    1) % 10 ) + '0'),
+    __COMPILE_TIMESTAMP_H_ISO8601_TIME_CHARS,
     '\0'
 };
+
+// All of the above in one object, with a single definition shared by every
+// translation unit (C++17 inline variable, or a selectany / weak symbol),
+// rather than one copy of each string per translation unit.
+typedef struct compile_timestamp_info_t
+{
+    unsigned           year;
+    unsigned           month;
+    unsigned           day;
+    unsigned           hour;
+    unsigned           minute;
+    unsigned           seconds;
+    unsigned short     msdos_date;
+    unsigned short     msdos_time;
+    unsigned long long unix_epoch;
+    unsigned long long packed;
+    char               iso8601_date[11];
+    char               iso8601_datetime[20];
+} compile_timestamp_info_t;
+
+// Without COMPILE_TIMESTAMP_SOURCE_DATE_EPOCH, __TIMESTAMP__ can differ between
+// translation units, so the definitions differ too.  An inline constexpr
+// variable would then violate the ODR, and each translation unit would fold
+// its own value, so it is only used when every definition is identical.
+// Otherwise, the selectany / weak object is not constexpr, and is read from
+// the single definition the linker keeps.
+#if defined(__cplusplus) && __cpp_inline_variables >= 201606L && defined(COMPILE_TIMESTAMP_SOURCE_DATE_EPOCH)
+    #define __COMPILE_TIMESTAMP_H_SINGLE_DEFINITION inline __COMPILE_TIMESTAMP_H_CONSTEXPR
+#elif defined(__cplusplus) && defined(_MSC_VER) && defined(COMPILE_TIMESTAMP_SOURCE_DATE_EPOCH)
+    #define __COMPILE_TIMESTAMP_H_SINGLE_DEFINITION extern __declspec(selectany) __COMPILE_TIMESTAMP_H_CONSTEXPR const
+#elif defined(__cplusplus) && defined(_MSC_VER)
+    #define __COMPILE_TIMESTAMP_H_SINGLE_DEFINITION extern __declspec(selectany) const
+#elif defined(__cplusplus) && (defined(__GNUC__) || defined(__clang__))
+    #define __COMPILE_TIMESTAMP_H_SINGLE_DEFINITION extern __attribute__((weak)) const
+#elif defined(_MSC_VER)
+    #define __COMPILE_TIMESTAMP_H_SINGLE_DEFINITION __declspec(selectany) const
+#elif defined(__GNUC__) || defined(__clang__)
+    #define __COMPILE_TIMESTAMP_H_SINGLE_DEFINITION __attribute__((weak)) const
+#else
+    #define __COMPILE_TIMESTAMP_H_SINGLE_DEFINITION static const // one copy per translation unit
+#endif
+
+__COMPILE_TIMESTAMP_H_SINGLE_DEFINITION
+compile_timestamp_info_t compile_timestamp_info =
+{
+    __TIMESTAMP_YEAR_INT__,
+    __TIMESTAMP_MONTH_INT__,
+    __TIMESTAMP_DAY_INT__,
+    __TIMESTAMP_HOUR_INT__,
+    __TIMESTAMP_MINUTE_INT__,
+    __TIMESTAMP_SECONDS_INT__,
+    (unsigned short)(__TIMESTAMP_MSDOS_DATE_INT__),
+    (unsigned short)(__TIMESTAMP_MSDOS_TIME_INT__),
+    __TIMESTAMP_UNIX_EPOCH__,
+    __TIMESTAMP_PACKED_INT__,
+    { __COMPILE_TIMESTAMP_H_ISO8601_DATE_CHARS, '\0' },
+    { __COMPILE_TIMESTAMP_H_ISO8601_DATE_CHARS, 'T', __COMPILE_TIMESTAMP_H_ISO8601_TIME_CHARS, '\0' }
+};
+
 #endif // COMPILE_TIMESTAMP_H
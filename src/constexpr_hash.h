@@ -0,0 +1,238 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef CONSTEXPR_HASH_H
+#define CONSTEXPR_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "constexpr_strlen.h"
+#include "constexpr_table.h"
+
+// String hashes that give identical results when evaluated at compile time
+// and at runtime.  This allows, for example, switching on a hashed key:
+//
+//     switch (constexpr_fnv1a_32(name)) {
+//         case constexpr_fnv1a_32("alpha"): ...
+//         case constexpr_fnv1a_32("beta"):  ...
+//     }
+//
+// Each hash has two overloads:
+//     (const char* s)             -- hashes up to the terminating null
+//     (const char* s, size_t len) -- hashes exactly len bytes
+
+#ifndef __has_builtin
+    #define __has_builtin(x) 0 // Compatibility with compilers lacking __has_builtin.
+#endif
+
+/**
+    The following, if defined prior to inclusion of this header file,
+    will modify its behavior as noted:
+
+        CONSTEXPR_HASH_NO_RUNTIME_KERNEL
+        -- if defined, constexpr_crc32c() uses the same table-driven code
+           at runtime as during constant evaluation, even when the SSE4.2
+           crc32 instruction is available.
+ */
+
+#if defined(CONSTEXPR_HASH_NO_RUNTIME_KERNEL)
+    // use the constant evaluation code path at runtime
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__SSE4_2__) && ( \
+      __has_builtin(__builtin_is_constant_evaluated) || \
+      (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) )
+    #include <nmmintrin.h>
+    #include <string.h>
+    #define __CONSTEXPR_HASH_H_SSE42_CRC32C
+#endif
+
+#if __cpp_constexpr >= 201304
+    // avr gcc -- not supported (as of v 5.4.0)
+    // gcc   5.1.0 and higher, using -std=c++14
+    // clang 3.4.0 and higher, using -std=c++14
+    // msvc  19.10 and higher
+
+    namespace SimpleHacks {
+    namespace _Detail {
+
+        constexpr inline uint32_t hash_rotl32( uint32_t x, unsigned r )
+        {
+            return (x << r) | (x >> (32u - r));
+        }
+
+        // little-endian read, so results do not depend on the host
+        constexpr inline uint32_t hash_read32( const char* p )
+        {
+            return  ((uint32_t)(uint8_t)p[0]       ) |
+                    ((uint32_t)(uint8_t)p[1] <<  8u) |
+                    ((uint32_t)(uint8_t)p[2] << 16u) |
+                    ((uint32_t)(uint8_t)p[3] << 24u) ;
+        }
+
+        constexpr inline uint32_t xxh32_round( uint32_t acc, uint32_t input )
+        {
+            return hash_rotl32(acc + input * 0x85EBCA77u, 13u) * 0x9E3779B1u;
+        }
+
+        // CRC32C (Castagnoli), reflected polynomial 0x82F63B78
+        struct crc32c_entry
+        {
+            constexpr uint32_t operator()( size_t i ) const
+            {
+                uint32_t c = (uint32_t)i;
+                for (int k = 0; k < 8; ++k) {
+                    c = (c & 1u) ? (0x82F63B78u ^ (c >> 1u)) : (c >> 1u);
+                }
+                return c;
+            }
+        };
+        using crc32c_table = SimpleHacks::CompileTime::chunked_table<crc32c_entry, 256>;
+
+    #if defined(__CONSTEXPR_HASH_H_SSE42_CRC32C)
+        // Eight bytes per crc32 instruction on x86-64, and four on 32-bit x86,
+        // which lacks _mm_crc32_u64
+        inline uint32_t runtime_crc32c( const char* s, size_t len )
+        {
+        #if defined(__x86_64__)
+            uint64_t crc = 0xFFFFFFFFu;
+            for (; len >= 8; s += 8, len -= 8) {
+                uint64_t v;
+                memcpy(&v, s, sizeof(v));
+                crc = _mm_crc32_u64(crc, v);
+            }
+            uint32_t crc32 = (uint32_t)crc;
+        #else
+            uint32_t crc32 = 0xFFFFFFFFu;
+            for (; len >= 4; s += 4, len -= 4) {
+                uint32_t v;
+                memcpy(&v, s, sizeof(v));
+                crc32 = _mm_crc32_u32(crc32, v);
+            }
+        #endif
+            for (; len != 0; ++s, --len) {
+                crc32 = _mm_crc32_u8(crc32, (uint8_t)*s);
+            }
+            return ~crc32;
+        }
+    #endif
+
+    } // namespace _Detail
+    } // namespace SimpleHacks
+
+    // FNV-1a, 32-bit
+    constexpr inline uint32_t constexpr_fnv1a_32( const char* s, size_t len )
+    {
+        uint32_t h = 0x811C9DC5u;
+        for (size_t i = 0; i < len; ++i) {
+            h = (h ^ (uint8_t)s[i]) * 0x01000193u;
+        }
+        return h;
+    }
+    constexpr inline uint32_t constexpr_fnv1a_32( const char* s )
+    {
+        return constexpr_fnv1a_32(s, constexpr_strlen(s));
+    }
+
+    // FNV-1a, 64-bit
+    constexpr inline uint64_t constexpr_fnv1a_64( const char* s, size_t len )
+    {
+        uint64_t h = 0xCBF29CE484222325ull;
+        for (size_t i = 0; i < len; ++i) {
+            h = (h ^ (uint8_t)s[i]) * 0x00000100000001B3ull;
+        }
+        return h;
+    }
+    constexpr inline uint64_t constexpr_fnv1a_64( const char* s )
+    {
+        return constexpr_fnv1a_64(s, constexpr_strlen(s));
+    }
+
+    // xxHash32 -- produces the same values as the reference XXH32()
+    constexpr inline uint32_t constexpr_xxh32( const char* s, size_t len, uint32_t seed = 0 )
+    {
+        using namespace SimpleHacks::_Detail;
+        const char* const end = s + len;
+        uint32_t h = 0;
+        if (len >= 16) {
+            uint32_t v1 = seed + 0x9E3779B1u + 0x85EBCA77u;
+            uint32_t v2 = seed + 0x85EBCA77u;
+            uint32_t v3 = seed;
+            uint32_t v4 = seed - 0x9E3779B1u;
+            for (; end - s >= 16; s += 16) {
+                v1 = xxh32_round(v1, hash_read32(s     ));
+                v2 = xxh32_round(v2, hash_read32(s +  4));
+                v3 = xxh32_round(v3, hash_read32(s +  8));
+                v4 = xxh32_round(v4, hash_read32(s + 12));
+            }
+            h = hash_rotl32(v1, 1u) + hash_rotl32(v2, 7u) + hash_rotl32(v3, 12u) + hash_rotl32(v4, 18u);
+        } else {
+            h = seed + 0x165667B1u;
+        }
+        h += (uint32_t)len;
+        for (; end - s >= 4; s += 4) {
+            h = hash_rotl32(h + hash_read32(s) * 0xC2B2AE3Du, 17u) * 0x27D4EB2Fu;
+        }
+        for (; s != end; ++s) {
+            h = hash_rotl32(h + (uint8_t)*s * 0x165667B1u, 11u) * 0x9E3779B1u;
+        }
+        h ^= h >> 15u;
+        h *= 0x85EBCA77u;
+        h ^= h >> 13u;
+        h *= 0xC2B2AE3Du;
+        h ^= h >> 16u;
+        return h;
+    }
+    constexpr inline uint32_t constexpr_xxh32( const char* s )
+    {
+        return constexpr_xxh32(s, constexpr_strlen(s));
+    }
+
+    // CRC32C (Castagnoli, as used by iSCSI / ext4 / SSE4.2)
+    // At runtime, uses the SSE4.2 crc32 instruction when compiled with -msse4.2
+    constexpr inline uint32_t constexpr_crc32c( const char* s, size_t len )
+    {
+    #if defined(__CONSTEXPR_HASH_H_SSE42_CRC32C)
+        if (!__builtin_is_constant_evaluated()) {
+            return SimpleHacks::_Detail::runtime_crc32c(s, len);
+        }
+    #endif
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < len; ++i) {
+            crc = SimpleHacks::_Detail::crc32c_table::value[(crc ^ (uint8_t)s[i]) & 0xFFu] ^ (crc >> 8u);
+        }
+        return ~crc;
+    }
+    constexpr inline uint32_t constexpr_crc32c( const char* s )
+    {
+        return constexpr_crc32c(s, constexpr_strlen(s));
+    }
+
+#endif // __cpp_constexpr >= 201304
+
+#endif // #ifndef CONSTEXPR_HASH_H
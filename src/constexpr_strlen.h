@@ -46,24 +46,195 @@ SOFTWARE.
     }
 #endif
 
-#if __cpp_constexpr >= 201603
+#ifndef __has_builtin
+    #define __has_builtin(x) 0 // Compatibility with compilers lacking __has_builtin.
+#endif
+
+/**
+    The following, if defined prior to inclusion of this header file,
+    will modify its behavior as noted:
+
+        CONSTEXPR_STRLEN_USE_BUILTIN
+        -- if defined, constexpr_strlen(const char*) uses __builtin_strlen(),
+           which the compiler folds at compile time without stepping through
+           each character.  Use for very large strings (e.g., embedded blobs).
+           Enabled by default for clang.  With gcc, the argument must then point
+           into a string literal or a namespace-scope constexpr array.
+
+        CONSTEXPR_STRLEN_NO_RUNTIME_KERNEL
+        -- if defined, constexpr_strlen(const char*) uses the same code path
+           at runtime as during constant evaluation, instead of dispatching
+           to the word-at-a-time / SSE2 / AVX2 scanner.
+ */
+
+#if defined(CONSTEXPR_STRLEN_USE_BUILTIN) || (defined(__clang__) && __has_builtin(__builtin_strlen))
+    #define __CONSTEXPR_STRLEN_H_USE_BUILTIN
+#endif
+
+// Detect whether the compiler can tell constant evaluation from runtime calls.
+// This is the intrinsic that std::is_constant_evaluated() is built upon.
+//     clang 9.0 and higher
+//     gcc   9.1 and higher
+//     msvc 19.25 and higher
+#if defined(CONSTEXPR_STRLEN_NO_RUNTIME_KERNEL)
+    // use the constant evaluation code path at runtime
+#elif __has_builtin(__builtin_is_constant_evaluated) || \
+      (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || \
+      (defined(_MSC_VER) && _MSC_VER >= 1925)
+    #define __CONSTEXPR_STRLEN_H_RUNTIME_KERNEL
+#endif
+
+#if defined(__CONSTEXPR_STRLEN_H_RUNTIME_KERNEL)
+
+    #include <stddef.h>
+    #include <stdint.h>
+    #include <string.h>
+    #if (defined(__GNUC__) || defined(__clang__)) && defined(__AVX2__)
+        #include <immintrin.h>
+        #define __CONSTEXPR_STRLEN_H_VECTOR_BYTES 32
+    #elif (defined(__GNUC__) || defined(__clang__)) && defined(__SSE2__)
+        #include <emmintrin.h>
+        #define __CONSTEXPR_STRLEN_H_VECTOR_BYTES 16
+    #endif
+
+    // The scanners below read whole aligned blocks, which may include bytes
+    // past the terminating null.  An aligned block never crosses a page
+    // boundary, so this cannot fault, but address sanitizers would report it.
+    #if defined(__clang__) || defined(__GNUC__)
+        #define __CONSTEXPR_STRLEN_H_NO_SANITIZE __attribute__((no_sanitize_address))
+    #else
+        #define __CONSTEXPR_STRLEN_H_NO_SANITIZE
+    #endif
+
+    namespace SimpleHacks {
+    namespace _Detail {
+
+    #if defined(__CONSTEXPR_STRLEN_H_VECTOR_BYTES)
+
+        // Bitmask of the bytes equal to zero in the aligned vector at p
+        __CONSTEXPR_STRLEN_H_NO_SANITIZE
+        inline uint32_t strlen_zero_mask( const char* p )
+        {
+        #if __CONSTEXPR_STRLEN_H_VECTOR_BYTES == 32
+            return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*)p), _mm256_setzero_si256()));
+        #else
+            return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*)p), _mm_setzero_si128()));
+        #endif
+        }
+
+        // Non-zero if the aligned 64-byte block at p contains a zero byte
+        __CONSTEXPR_STRLEN_H_NO_SANITIZE
+        inline uint32_t strlen_block_has_zero( const char* p )
+        {
+        #if __CONSTEXPR_STRLEN_H_VECTOR_BYTES == 32
+            const __m256i m = _mm256_min_epu8(_mm256_load_si256((const __m256i*)(p     )),
+                                              _mm256_load_si256((const __m256i*)(p + 32)));
+            return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(m, _mm256_setzero_si256()));
+        #else
+            const __m128i m = _mm_min_epu8(
+                                  _mm_min_epu8(_mm_load_si128((const __m128i*)(p     )), _mm_load_si128((const __m128i*)(p + 16))),
+                                  _mm_min_epu8(_mm_load_si128((const __m128i*)(p + 32)), _mm_load_si128((const __m128i*)(p + 48))));
+            return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(m, _mm_setzero_si128()));
+        #endif
+        }
+
+        // SSE2 / AVX2 scanner: compares aligned vectors against zero,
+        // 64 bytes per iteration once the pointer is 64-byte aligned.
+        __CONSTEXPR_STRLEN_H_NO_SANITIZE
+        inline size_t runtime_strlen( const char* s )
+        {
+            if (0 == s) return 0;
+
+            const size_t offset = (size_t)((uintptr_t)s % __CONSTEXPR_STRLEN_H_VECTOR_BYTES);
+            const char*  p      = s - offset;
+            uint32_t     mask   = strlen_zero_mask(p) >> offset; // ignore bytes prior to the start of the string
+            if (mask != 0) {
+                return (size_t)__builtin_ctz(mask);
+            }
+            // one vector at a time, until aligned for the 64-byte blocks
+            for (p += __CONSTEXPR_STRLEN_H_VECTOR_BYTES; ((uintptr_t)p % 64u) != 0; p += __CONSTEXPR_STRLEN_H_VECTOR_BYTES) {
+                mask = strlen_zero_mask(p);
+                if (mask != 0) {
+                    return (size_t)(p - s) + (size_t)__builtin_ctz(mask);
+                }
+            }
+            while (!strlen_block_has_zero(p)) {
+                p += 64;
+            }
+            for (;; p += __CONSTEXPR_STRLEN_H_VECTOR_BYTES) {
+                mask = strlen_zero_mask(p);
+                if (mask != 0) {
+                    return (size_t)(p - s) + (size_t)__builtin_ctz(mask);
+                }
+            }
+        }
+
+    #else
+
+        // Portable word-at-a-time scanner: checks sizeof(size_t) bytes per
+        // iteration, using the classic "has zero byte" bit trick.
+        __CONSTEXPR_STRLEN_H_NO_SANITIZE
+        inline size_t runtime_strlen( const char* s )
+        {
+            if (0 == s) return 0;
+
+            const char* p = s;
+            // byte-at-a-time until aligned, so no word read crosses a page
+            for (; ((uintptr_t)p % sizeof(size_t)) != 0; ++p) {
+                if (*p == '\0') return (size_t)(p - s);
+            }
+
+            const size_t ones  = (size_t)-1 / 0xFF;  // 0x0101...01
+            const size_t highs = ones * 0x80;        // 0x8080...80
+            for (;; p += sizeof(size_t)) {
+                size_t v;
+                memcpy(&v, p, sizeof(v));
+                if (((v - ones) & ~v & highs) != 0) {
+                    break;
+                }
+            }
+            while (*p != '\0') {
+                ++p;
+            }
+            return (size_t)(p - s);
+        }
+
+    #endif
+
+    } // namespace _Detail
+    } // namespace SimpleHacks
+
+#endif // __CONSTEXPR_STRLEN_H_RUNTIME_KERNEL
+
+#if __cpp_constexpr >= 201304
     // avr gcc -- not supported (as of v 5.4.0)
-    // msvc    -- not supported (as of v 19.22)
-    // gcc   7.2.1 and higher, using -std=c++17
-    // clang 5.0.0 and higher, using -std=c++17
+    // gcc   5.1.0 and higher, using -std=c++14
+    // clang 3.4.0 and higher, using -std=c++14
+    // msvc  19.10 and higher
+    // Iterative, so there is no recursion depth limit (e.g., -fconstexpr-depth),
+    // and each character costs only a few constexpr evaluation steps.
+    // When called at runtime, dispatches to a vectorized scanner (if available).
     constexpr inline size_t constexpr_strlen( const char* s )
     {
-        return (
-            (0 == s) ? 0 :
-                (*s == '\0') ? 0 :
-                    1 + constexpr_strlen((const char*)(s+1))
-            );
+    #if defined(__CONSTEXPR_STRLEN_H_RUNTIME_KERNEL)
+        if (!__builtin_is_constant_evaluated()) {
+            return SimpleHacks::_Detail::runtime_strlen(s);
+        }
+    #endif
+    #if defined(__CONSTEXPR_STRLEN_H_USE_BUILTIN)
+        return (0 == s) ? 0 : __builtin_strlen(s);
+    #else
+        size_t n = 0;
+        if (0 != s) {
+            while (s[n] != '\0') {
+                ++n;
+            }
+        }
+        return n;
+    #endif
     }
 #endif
 
-
-
-
 #endif // #ifndef CONSTEXPR_STRLEN_H
 
 
@@ -0,0 +1,130 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef SIMPLEHACKS_CONSTEXPR_TABLE_H
+#define SIMPLEHACKS_CONSTEXPR_TABLE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <array>
+
+#include "integer_seq.h"
+
+// Generates lookup tables at compile time, by evaluating a constexpr
+// functor at each index [0, N).  e.g.,
+//
+//     struct popcount8 {
+//         constexpr unsigned char operator()(std::size_t i) const {
+//             return i == 0 ? 0 : (i & 1) + popcount8{}(i >> 1);
+//         }
+//     };
+//     constexpr auto table = SimpleHacks::CompileTime::make_table<256>(popcount8{});
+//
+// For large tables, use chunked_table<F, N>::value instead (see below).
+namespace SimpleHacks {
+namespace CompileTime {
+
+    // The element type of a table generated from functor F
+    // ALIAS:  table_element_t<F>          ==> decay of F(std::size_t)'s return type
+    template<typename F>
+    using table_element_t = typename std::decay<decltype(std::declval<F const&>()(std::size_t()))>::type;
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail
+    {
+        template<typename F, std::size_t... I>
+        constexpr std::array<table_element_t<F>, sizeof...(I)>
+        make_table_impl(F const & f, integer_sequence<std::size_t, I...>)
+        {
+            return std::array<table_element_t<F>, sizeof...(I)>{{ f(I)... }};
+        }
+
+        // Evaluates F for [Base, Base + sizeof...(J)) as a separate constant
+        // expression, so the compiler's constexpr step limit applies per chunk.
+        template<typename F, std::size_t Base, typename Seq>
+        struct table_chunk;
+
+        template<typename F, std::size_t Base, std::size_t... J>
+        struct table_chunk<F, Base, integer_sequence<std::size_t, J...>>
+        {
+            static constexpr table_element_t<F> data[sizeof...(J) ? sizeof...(J) : 1] = { F{}(Base + J)... };
+        };
+        // C++11 rules require the static constexpr variable to be instantiated outside the template
+        template<typename F, std::size_t Base, std::size_t... J>
+        constexpr table_element_t<F> table_chunk<F, Base, integer_sequence<std::size_t, J...>>::data[sizeof...(J) ? sizeof...(J) : 1];
+
+        template<typename F, std::size_t N, std::size_t ChunkSize, std::size_t C>
+        struct table_chunk_at
+        {
+            static constexpr std::size_t base = C * ChunkSize;
+            static constexpr std::size_t size = (N - base < ChunkSize) ? (N - base) : ChunkSize;
+            using type = table_chunk<F, base, make_integer_sequence<std::size_t, size>>;
+        };
+
+        template<typename F, std::size_t N, std::size_t ChunkSize, typename Seq>
+        struct chunked_table_impl;
+
+        template<typename F, std::size_t N, std::size_t ChunkSize, std::size_t... I>
+        struct chunked_table_impl<F, N, ChunkSize, integer_sequence<std::size_t, I...>>
+        {
+            static constexpr std::array<table_element_t<F>, N> value = {{
+                table_chunk_at<F, N, ChunkSize, I / ChunkSize>::type::data[I % ChunkSize]...
+            }};
+        };
+        // C++11 rules require the static constexpr variable to be instantiated outside the template
+        template<typename F, std::size_t N, std::size_t ChunkSize, std::size_t... I>
+        constexpr std::array<table_element_t<F>, N> chunked_table_impl<F, N, ChunkSize, integer_sequence<std::size_t, I...>>::value;
+    }
+
+    // Returns std::array{ f(0), f(1), ... f(N-1) } as a single constant expression.
+    // The pack expansion is flat, so there is no recursion depth limit, but the
+    // compiler's constexpr step limit applies to the table as a whole.
+    template<std::size_t N, typename F>
+    constexpr std::array<table_element_t<F>, N> make_table(F const & f)
+    {
+        return _Detail::make_table_impl(f, make_integer_sequence<std::size_t, N>{});
+    }
+
+    // chunked_table<F, N>::value is a static constexpr std::array{ F{}(0), ... F{}(N-1) }.
+    // Each ChunkSize entries are evaluated as a separate constant expression,
+    // so large tables (e.g., 64k entries) stay within the constexpr step limits.
+    // F must be a literal type that is default constructible, such as a
+    // functor struct, or (C++20) the type of a captureless lambda.
+    template<typename F, std::size_t N, std::size_t ChunkSize = 256>
+    struct chunked_table
+        : _Detail::chunked_table_impl<F, N, ChunkSize, make_integer_sequence<std::size_t, N>>
+    {
+        static_assert( ChunkSize > 0, "ChunkSize cannot be zero" );
+    };
+
+}  // namespace CompileTime
+}  // namespace SimpleHacks
+
+#endif  // SIMPLEHACKS_CONSTEXPR_TABLE_H
@@ -0,0 +1,404 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef FAT_IMAGE_H
+#define FAT_IMAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "array_size2.h"
+
+// Generates, at compile time, the metadata sectors of a small read-only
+// FAT12 / FAT16 volume:  the boot sector, the file allocation table, and the
+// root directory.  Firmware that emulates a USB mass-storage drive (e.g., a
+// UF2 bootloader's "ghost" FAT filesystem) can then answer each read request
+// with a memcpy from flash, instead of building those sectors on every read.
+//
+//     constexpr SimpleHacks::fat_volume volume = {
+//         "GHOSTFAT", 8000, 1, 64, __TIMESTAMP_MSDOS_DATE_INT__, __TIMESTAMP_MSDOS_TIME_INT__, 0x00420042
+//     };
+//     constexpr SimpleHacks::fat_file files[] = {
+//         { "INFO_UF2.TXT", sizeof(info_uf2) - 1 },
+//         { "INDEX.HTM",    sizeof(index_htm) - 1 },
+//     };
+//     constexpr auto image = FAT_IMAGE(volume, files);
+//
+// The date and time are MS-DOS packed values, such as those from
+// timestamp.h, compile_timestamp.h or fat_time.h.  Files are laid out in
+// consecutive clusters, in the order given.  Invalid input is reported at
+// compile time, as a call to a (non-constexpr) function whose name
+// describes the problem, e.g., FAT_IMAGE_INVALID_FILE_NAME().
+
+#if __cpp_constexpr >= 201304
+    // avr gcc -- not supported (as of v 5.4.0)
+    // gcc   5.1.0 and higher, using -std=c++14
+    // clang 3.4.0 and higher, using -std=c++14
+    // msvc  19.10 and higher
+
+namespace SimpleHacks {
+
+    static constexpr size_t fat_sector_size = 512u;
+
+    struct fat_file
+    {
+        const char* name;  // 8.3 name, e.g., "INDEX.HTM"; lower case is converted to upper case
+        uint32_t    size;  // in bytes
+        uint16_t    date;  // MS-DOS packed date, or zero to use the volume's date
+        uint16_t    time;  // MS-DOS packed time
+    };
+
+    struct fat_volume
+    {
+        const char* label;                // up to 11 characters
+        uint32_t    total_sectors;        // reported size of the drive, in 512-byte sectors
+        uint8_t     sectors_per_cluster;  // power of two, 1..128
+        uint16_t    root_entries;         // multiple of 16
+        uint16_t    date;                 // MS-DOS packed date, e.g., __TIMESTAMP_MSDOS_DATE_INT__
+        uint16_t    time;                 // MS-DOS packed time, e.g., __TIMESTAMP_MSDOS_TIME_INT__
+        uint32_t    serial;               // volume serial number
+    };
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail {
+
+        // Not constexpr, on purpose.  If constant evaluation reaches these, the
+        // compiler reports an error that includes the function's name.
+        inline void FAT_IMAGE_INVALID_FILE_NAME() {}
+        inline void FAT_IMAGE_INVALID_VOLUME_LABEL() {}
+        inline void FAT_IMAGE_INVALID_GEOMETRY() {}
+        inline void FAT_IMAGE_DUPLICATE_FILE_NAME() {}
+        inline void FAT_IMAGE_TOO_MANY_FILES() {}
+        inline void FAT_IMAGE_FILES_DO_NOT_FIT() {}
+        inline void FAT_IMAGE_FAT_SECTORS_MISMATCH() {}
+
+        // Maximum cluster counts for FAT12 and FAT16, per the specification
+        static constexpr uint32_t fat12_max_clusters = 4084u;
+        static constexpr uint32_t fat16_max_clusters = 65524u;
+
+        struct fat_layout
+        {
+            uint32_t fat_sectors;   // sectors per FAT (there are two FATs)
+            uint32_t root_sectors;
+            uint32_t data_start;    // first sector of cluster 2
+            uint32_t clusters;      // clusters available for data
+            bool     fat16;
+        };
+
+        constexpr inline fat_layout fat_compute_layout( const fat_volume& v )
+        {
+            fat_layout l{};
+            const uint32_t spc = v.sectors_per_cluster;
+            if (spc == 0u || (spc & (spc - 1u)) != 0u || v.root_entries == 0u || (v.root_entries % 16u) != 0u) {
+                FAT_IMAGE_INVALID_GEOMETRY();
+            }
+            l.root_sectors = v.root_entries * 32u / fat_sector_size;
+            // the FAT's size depends on the cluster count, which depends on the FAT's size
+            l.fat_sectors = 1u;
+            for (;;) {
+                const uint32_t overhead = 1u + 2u * l.fat_sectors + l.root_sectors;
+                if (v.total_sectors <= overhead + spc) {
+                    FAT_IMAGE_INVALID_GEOMETRY();
+                }
+                l.clusters = (v.total_sectors - overhead) / spc;
+                l.fat16    = l.clusters > fat12_max_clusters;
+                const uint32_t bytes  = l.fat16 ? (l.clusters + 2u) * 2u : ((l.clusters + 2u) * 3u + 1u) / 2u;
+                const uint32_t needed = (bytes + fat_sector_size - 1u) / fat_sector_size;
+                if (needed <= l.fat_sectors) break;
+                l.fat_sectors = needed;
+            }
+            if (l.clusters > fat16_max_clusters) {
+                FAT_IMAGE_INVALID_GEOMETRY();
+            }
+            l.data_start = 1u + 2u * l.fat_sectors + l.root_sectors;
+            return l;
+        }
+
+        constexpr inline uint32_t fat_file_clusters( const fat_volume& v, const fat_file& f )
+        {
+            const uint32_t cluster_bytes = v.sectors_per_cluster * (uint32_t)fat_sector_size;
+            return (f.size + cluster_bytes - 1u) / cluster_bytes;
+        }
+
+        constexpr inline char fat_name_char( char c )
+        {
+            if (c >= 'a' && c <= 'z') return (char)(c - 'a' + 'A');
+            if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) return c;
+            const char* allowed = "!#$%&'()-@^_`{}~";
+            for (size_t i = 0; allowed[i] != '\0'; ++i) {
+                if (c == allowed[i]) return c;
+            }
+            FAT_IMAGE_INVALID_FILE_NAME();
+            return '_';
+        }
+
+        // "index.htm" ==> "INDEX   HTM"
+        constexpr inline void fat_short_name( const char* name, uint8_t* out )
+        {
+            for (size_t i = 0; i < 11u; ++i) {
+                out[i] = ' ';
+            }
+            size_t i = 0;
+            for (; name[i] != '\0' && name[i] != '.'; ++i) {
+                if (i >= 8u) FAT_IMAGE_INVALID_FILE_NAME();
+                out[i] = (uint8_t)fat_name_char(name[i]);
+            }
+            if (i == 0u) FAT_IMAGE_INVALID_FILE_NAME();
+            if (name[i] == '.') {
+                const char* ext = name + i + 1u;
+                size_t j = 0;
+                for (; ext[j] != '\0'; ++j) {
+                    if (j >= 3u) FAT_IMAGE_INVALID_FILE_NAME();
+                    out[8u + j] = (uint8_t)fat_name_char(ext[j]);
+                }
+                if (j == 0u) FAT_IMAGE_INVALID_FILE_NAME();
+            }
+        }
+
+        constexpr inline void fat_put16( uint8_t* out, uint32_t value )
+        {
+            out[0] = (uint8_t)(value      );
+            out[1] = (uint8_t)(value >>  8);
+        }
+        constexpr inline void fat_put32( uint8_t* out, uint32_t value )
+        {
+            out[0] = (uint8_t)(value      );
+            out[1] = (uint8_t)(value >>  8);
+            out[2] = (uint8_t)(value >> 16);
+            out[3] = (uint8_t)(value >> 24);
+        }
+
+        // Writes FAT entry n, if it falls within the first `size` bytes of the table
+        constexpr inline void fat_put_entry( uint8_t* fat, size_t size, bool fat16, uint32_t n, uint32_t value )
+        {
+            if (fat16) {
+                if (2u * n + 1u < size) {
+                    fat_put16(fat + 2u * n, value);
+                }
+                return;
+            }
+            const size_t offset = n + n / 2u;
+            if (offset + 1u >= size) return;
+            if ((n & 1u) == 0u) {
+                fat[offset]      = (uint8_t)value;
+                fat[offset + 1u] = (uint8_t)((fat[offset + 1u] & 0xF0u) | ((value >> 8) & 0x0Fu));
+            } else {
+                fat[offset]      = (uint8_t)((fat[offset] & 0x0Fu) | ((value & 0x0Fu) << 4));
+                fat[offset + 1u] = (uint8_t)(value >> 4);
+            }
+        }
+
+    } // namespace _Detail
+
+    // Sectors at the start of each FAT that are not all zero, for these files.
+    // This is the FatSectors parameter of make_fat_image().
+    template<size_t N>
+    constexpr size_t fat_image_used_fat_sectors( const fat_volume& volume, const fat_file (&files)[N] )
+    {
+        const _Detail::fat_layout layout = _Detail::fat_compute_layout(volume);
+        uint32_t clusters = 0;
+        for (size_t i = 0; i < N; ++i) {
+            clusters += _Detail::fat_file_clusters(volume, files[i]);
+        }
+        if (clusters > layout.clusters) {
+            _Detail::FAT_IMAGE_FILES_DO_NOT_FIT();
+        }
+        const uint32_t entries = 2u + clusters;
+        const uint32_t bytes   = layout.fat16 ? entries * 2u : (entries * 3u + 1u) / 2u;
+        return (bytes + fat_sector_size - 1u) / fat_sector_size;
+    }
+
+    // The metadata of a read-only FAT volume, for N files.  Only the sectors
+    // that are not all zero are stored:  FatSectors of each FAT (both FATs
+    // are identical), and enough of the root directory for the volume label
+    // and N entries.
+    template<size_t N, size_t FatSectors>
+    struct fat_image
+    {
+        static constexpr size_t file_count   = N;
+        static constexpr size_t root_sectors = ((N + 1u) * 32u + fat_sector_size - 1u) / fat_sector_size;
+
+        uint8_t  boot[fat_sector_size];
+        uint8_t  fat[FatSectors * fat_sector_size];
+        uint8_t  root[root_sectors * fat_sector_size];
+
+        uint32_t total_sectors;
+        uint32_t sectors_per_cluster;
+        uint32_t fat_start;                   // first sector of the first FAT
+        uint32_t fat_sectors;                 // sectors per FAT
+        uint32_t root_start;                  // first sector of the root directory
+        uint32_t data_start;                  // first sector of cluster 2
+        uint32_t file_start[N ? N : 1];       // first sector of each file
+        uint32_t file_size[N ? N : 1];        // size of each file, in bytes
+
+        // Copies sector lba into out (512 bytes) and returns true, if it holds
+        // filesystem metadata or no data.  Otherwise, returns false, with the
+        // index of the file and the byte offset of the sector within it.
+        // The caller copies min(512, size - offset) bytes of that file, and
+        // fills the remainder of the sector with zero.
+        bool read_sector( uint32_t lba, uint8_t* out, size_t* file, uint32_t* offset ) const
+        {
+            const uint8_t* source = nullptr;
+            if (lba == 0u) {
+                source = boot;
+            } else if (lba >= fat_start && lba < root_start) {
+                const uint32_t index = (lba - fat_start) % fat_sectors;
+                if (index < FatSectors) {
+                    source = fat + index * fat_sector_size;
+                }
+            } else if (lba >= root_start && lba < root_start + root_sectors) {
+                source = root + (lba - root_start) * fat_sector_size;
+            } else if (lba >= data_start) {
+                for (size_t i = 0; i < N; ++i) {
+                    const uint32_t bytes = (lba - file_start[i]) * (uint32_t)fat_sector_size;
+                    if (lba >= file_start[i] && bytes < file_size[i]) {
+                        *file   = i;
+                        *offset = bytes;
+                        return false;
+                    }
+                }
+            }
+            if (source) {
+                memcpy(out, source, fat_sector_size);
+            } else {
+                memset(out, 0, fat_sector_size);
+            }
+            return true;
+        }
+    };
+
+    // Prefer the FAT_IMAGE(volume, files) macro, which supplies the template arguments
+    template<size_t N, size_t FatSectors>
+    constexpr fat_image<N, FatSectors> make_fat_image( const fat_volume& volume, const fat_file (&files)[N] )
+    {
+        using image_t = fat_image<N, FatSectors>;
+        const _Detail::fat_layout layout = _Detail::fat_compute_layout(volume);
+        if (FatSectors != fat_image_used_fat_sectors(volume, files)) {
+            _Detail::FAT_IMAGE_FAT_SECTORS_MISMATCH();
+        }
+        if (N + 1u > volume.root_entries) {
+            _Detail::FAT_IMAGE_TOO_MANY_FILES();
+        }
+
+        image_t image{};
+        image.total_sectors       = volume.total_sectors;
+        image.sectors_per_cluster = volume.sectors_per_cluster;
+        image.fat_start           = 1u;
+        image.fat_sectors         = layout.fat_sectors;
+        image.root_start          = 1u + 2u * layout.fat_sectors;
+        image.data_start          = layout.data_start;
+
+        // boot sector, with the DOS 4.0 extended BIOS parameter block
+        uint8_t* b = image.boot;
+        b[0] = 0xEBu; b[1] = 0x3Cu; b[2] = 0x90u;  // jmp short, nop
+        for (size_t i = 0; i < 8u; ++i) {
+            b[3u + i] = (uint8_t)"MSWIN4.1"[i];
+        }
+        _Detail::fat_put16(b + 11, fat_sector_size);
+        b[13] = volume.sectors_per_cluster;
+        _Detail::fat_put16(b + 14, 1u);            // reserved sectors
+        b[16] = 2u;                                // number of FATs
+        _Detail::fat_put16(b + 17, volume.root_entries);
+        _Detail::fat_put16(b + 19, volume.total_sectors < 0x10000u ? volume.total_sectors : 0u);
+        b[21] = 0xF8u;                             // media:  fixed disk
+        _Detail::fat_put16(b + 22, layout.fat_sectors);
+        _Detail::fat_put16(b + 24, 1u);            // sectors per track
+        _Detail::fat_put16(b + 26, 1u);            // heads
+        _Detail::fat_put32(b + 32, volume.total_sectors < 0x10000u ? 0u : volume.total_sectors);
+        b[36] = 0x80u;                             // drive number
+        b[38] = 0x29u;                             // extended boot signature
+        _Detail::fat_put32(b + 39, volume.serial);
+        for (size_t i = 0; i < 11u; ++i) {
+            b[43u + i] = ' ';
+        }
+        for (size_t i = 0; volume.label && volume.label[i] != '\0'; ++i) {
+            if (i >= 11u) _Detail::FAT_IMAGE_INVALID_VOLUME_LABEL();
+            b[43u + i] = (volume.label[i] == ' ') ? (uint8_t)' ' : (uint8_t)_Detail::fat_name_char(volume.label[i]);
+        }
+        for (size_t i = 0; i < 8u; ++i) {
+            b[54u + i] = (uint8_t)(layout.fat16 ? "FAT16   " : "FAT12   ")[i];
+        }
+        b[510] = 0x55u; b[511] = 0xAAu;
+
+        // root directory:  the volume label, then one entry per file
+        uint8_t* r = image.root;
+        for (size_t i = 0; i < 11u; ++i) {
+            r[i] = b[43u + i];
+        }
+        r[11] = 0x08u;                             // attribute:  volume label
+        _Detail::fat_put16(r + 22, volume.time);
+        _Detail::fat_put16(r + 24, volume.date);
+
+        const size_t fat_bytes = FatSectors * fat_sector_size;
+        const uint32_t end_of_chain = layout.fat16 ? 0xFFFFu : 0xFFFu;
+        _Detail::fat_put_entry(image.fat, fat_bytes, layout.fat16, 0u, end_of_chain & ~0x07u); // media byte 0xF8
+        _Detail::fat_put_entry(image.fat, fat_bytes, layout.fat16, 1u, end_of_chain);
+
+        uint32_t cluster = 2u;
+        for (size_t i = 0; i < N; ++i) {
+            const uint32_t count = _Detail::fat_file_clusters(volume, files[i]);
+            const uint16_t date  = files[i].date ? files[i].date : volume.date;
+            const uint16_t time  = files[i].date ? files[i].time : volume.time;
+            uint8_t* e = r + (i + 1u) * 32u;
+            _Detail::fat_short_name(files[i].name, e);
+            for (size_t j = 0; j < i; ++j) {
+                bool same = true;
+                for (size_t k = 0; k < 11u; ++k) {
+                    same = same && (r[(j + 1u) * 32u + k] == e[k]);
+                }
+                if (same) _Detail::FAT_IMAGE_DUPLICATE_FILE_NAME();
+            }
+            e[11] = 0x01u;                         // attribute:  read-only
+            _Detail::fat_put16(e + 14, time);      // created
+            _Detail::fat_put16(e + 16, date);
+            _Detail::fat_put16(e + 18, date);      // last accessed
+            _Detail::fat_put16(e + 22, time);      // last written
+            _Detail::fat_put16(e + 24, date);
+            _Detail::fat_put16(e + 26, count ? cluster : 0u);
+            _Detail::fat_put32(e + 28, files[i].size);
+
+            image.file_start[i] = layout.data_start + (cluster - 2u) * volume.sectors_per_cluster;
+            image.file_size[i]  = files[i].size;
+            for (uint32_t c = 0; c < count; ++c, ++cluster) {
+                _Detail::fat_put_entry(image.fat, fat_bytes, layout.fat16, cluster, (c + 1u == count) ? end_of_chain : cluster + 1u);
+            }
+        }
+        return image;
+    }
+
+} // namespace SimpleHacks
+
+// Generates the fat_image for a constexpr fat_volume and constexpr array of fat_file
+#define FAT_IMAGE(volume, files) \
+    SimpleHacks::make_fat_image<ARRAY_SIZE2(files), SimpleHacks::fat_image_used_fat_sectors((volume), (files))>((volume), (files))
+
+#endif // __cpp_constexpr >= 201304
+
+#endif // #ifndef FAT_IMAGE_H
@@ -0,0 +1,406 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef FAT_TIME_H
+#define FAT_TIME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Converts MS-DOS / FAT packed timestamps, as stored in FAT directory entries
+// and produced by the __DATE_MSDOS_INT__ / __TIME_MSDOS_INT__ macros:
+//
+//     date:  bits 15..9 = year - 1980, bits 8..5 = month (1..12), bits 4..0 = day (1..31)
+//     time:  bits 15..11 = hour (0..23), bits 10..5 = minute (0..59), bits 4..0 = seconds / 2
+//
+// The scalar functions are constexpr, so the same code converts at compile
+// time (e.g., when building a filesystem image) and at runtime.  The batch
+// functions convert many timestamps, using AVX2 when available.
+//
+// The representable range is 1980-01-01 00:00:00 through 2107-12-31 23:59:58,
+// with two second resolution.  Epoch seconds outside this range are clamped
+// to it, and odd seconds are rounded down.  Packed values with out-of-range
+// fields (e.g., month 13) convert without error to an unspecified value.
+
+#if __cpp_constexpr >= 201304
+    // avr gcc -- not supported (as of v 5.4.0)
+    // gcc   5.1.0 and higher, using -std=c++14
+    // clang 3.4.0 and higher, using -std=c++14
+    // msvc  19.10 and higher
+
+#include "constexpr_table.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define __FAT_TIME_H_AVX2
+#endif
+
+namespace SimpleHacks {
+
+    // Matches the on-disk order of a FAT directory entry (time at offset 0x16,
+    // date at 0x18), so an array of these can be loaded as 32-bit values.
+    struct fat_datetime
+    {
+        uint16_t time;
+        uint16_t date;
+    };
+
+    struct fat_fields
+    {
+        uint16_t year;     // 1980..2107
+        uint8_t  month;    // 1..12
+        uint8_t  day;      // 1..31
+        uint8_t  hour;     // 0..23
+        uint8_t  minute;   // 0..59
+        uint8_t  seconds;  // 0..58, always even
+        uint8_t  reserved; // zero
+    };
+
+    // Seconds since 1970-01-01 (UTC) for the first and last FAT timestamps
+    static constexpr uint64_t fat_epoch_min = 315532800ull;   // 1980-01-01 00:00:00
+    static constexpr uint64_t fat_epoch_max = 4354819198ull;  // 2107-12-31 23:59:58
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail {
+
+        constexpr inline uint32_t fat_is_leap( uint32_t year )
+        {
+            return ((year % 4u == 0u) && (year % 100u != 0u)) || (year % 400u == 0u);
+        }
+
+        constexpr inline uint32_t fat_year_start( uint32_t index )
+        {
+            uint32_t days = 0;
+            for (uint32_t i = 0; i < index; ++i) {
+                days += 365u + fat_is_leap(1980u + i);
+            }
+            return days;
+        }
+
+        // Indexed by year - 1980, for [1980, 2108]:
+        //     bits 15..0 = days from 1980-01-01 to January 1st
+        //     bit  16    = this year is a leap year
+        //     bit  17    = the previous year was a leap year
+        struct fat_year_info
+        {
+            constexpr uint32_t operator()( size_t index ) const
+            {
+                return fat_year_start((uint32_t)index)
+                     | (fat_is_leap(1980u + (uint32_t)index) << 16)
+                     | (fat_is_leap(1979u + (uint32_t)index) << 17);
+            }
+        };
+
+        // Indexed by leap * 366 + day of the year (0-based):  (month << 5) | day,
+        // which are bits 8..0 of the packed date.
+        struct fat_month_day
+        {
+            constexpr uint32_t operator()( size_t index ) const
+            {
+                const uint32_t leap = index >= 366u;
+                uint32_t doy = (uint32_t)index - leap * 366u;
+                uint32_t month = 1;
+                for (; month <= 12u; ++month) {
+                    const uint32_t length = (month == 2u) ? 28u + leap : 30u + ((month + (month >> 3)) & 1u);
+                    if (doy < length) break;
+                    doy -= length;
+                }
+                return (month <= 12u) ? ((month << 5) | (doy + 1u)) : 0u;
+            }
+        };
+
+        // Indexed by (leap << 4) | month:  days before the first of the month.
+        // Entries for months 0 and 13..15 are zero.
+        struct fat_month_start
+        {
+            constexpr uint32_t operator()( size_t index ) const
+            {
+                const uint32_t leap  = (uint32_t)(index >> 4);
+                const uint32_t month = (uint32_t)(index & 15u);
+                uint32_t days = 0;
+                if (month < 1u || month > 12u) return 0;
+                for (uint32_t m = 1; m < month; ++m) {
+                    days += (m == 2u) ? 28u + leap : 30u + ((m + (m >> 3)) & 1u);
+                }
+                return days;
+            }
+        };
+
+        using fat_year_table        = CompileTime::chunked_table<fat_year_info,   129>;
+        using fat_month_day_table   = CompileTime::chunked_table<fat_month_day,   732>;
+        using fat_month_start_table = CompileTime::chunked_table<fat_month_start,  32>;
+
+    } // namespace _Detail
+
+    constexpr inline fat_datetime fat_from_fields( const fat_fields& f )
+    {
+        return fat_datetime{
+            (uint16_t)((f.hour << 11) | (f.minute << 5) | (f.seconds >> 1)),
+            (uint16_t)(((f.year - 1980u) << 9) | (f.month << 5) | f.day)
+        };
+    }
+
+    constexpr inline fat_fields fat_to_fields( fat_datetime t )
+    {
+        return fat_fields{
+            (uint16_t)((t.date >> 9) + 1980u),
+            (uint8_t)((t.date >> 5) & 15u),
+            (uint8_t)(t.date & 31u),
+            (uint8_t)(t.time >> 11),
+            (uint8_t)((t.time >> 5) & 63u),
+            (uint8_t)((t.time & 31u) << 1),
+            0
+        };
+    }
+
+    // Seconds since 1970-01-01 (UTC), treating the FAT timestamp as UTC
+    constexpr inline uint64_t fat_to_epoch( fat_datetime t )
+    {
+        const uint32_t info  = _Detail::fat_year_table::value[t.date >> 9];
+        const uint32_t leap  = (info >> 16) & 1u;
+        const uint32_t days  = (info & 0xFFFFu)
+                             + _Detail::fat_month_start_table::value[(leap << 4) | ((t.date >> 5) & 15u)]
+                             + (t.date & 31u) - 1u;
+        const uint32_t sod   = (t.time >> 11) * 3600u + ((t.time >> 5) & 63u) * 60u + ((t.time & 31u) << 1);
+        return fat_epoch_min + (uint32_t)(days * 86400u + sod);
+    }
+
+    // Clamps to [fat_epoch_min, fat_epoch_max], and rounds odd seconds down.
+    // The divisions are replaced by multiplies, exhaustively verified over
+    // the clamped range, which the batch function repeats eight at a time.
+    constexpr inline fat_datetime fat_from_epoch( uint64_t epoch )
+    {
+        const uint64_t e = (epoch < fat_epoch_min) ? 0u
+                         : (epoch > fat_epoch_max) ? (fat_epoch_max - fat_epoch_min)
+                         : (epoch - fat_epoch_min);
+        const uint32_t days = (uint32_t)((e * 3257812231ull) >> 48);      // e / 86400
+        const uint32_t sod  = (uint32_t)e - days * 86400u;
+
+        // days / 365 is the year, or one year later
+        uint32_t year  = (days * 45965u) >> 24;
+        uint32_t info  = _Detail::fat_year_table::value[year];
+        uint32_t start = info & 0xFFFFu;
+        uint32_t leap  = (info >> 16) & 1u;
+        if (days < start) {
+            year  -= 1u;
+            leap   = (info >> 17) & 1u;
+            start -= 365u + leap;
+        }
+        const uint32_t md = _Detail::fat_month_day_table::value[leap * 366u + (days - start)];
+
+        const uint32_t hour   = (sod * 37283u) >> 27;                     // sod / 3600
+        const uint32_t rem    = sod - hour * 3600u;
+        const uint32_t minute = (rem * 2185u) >> 17;                      // rem / 60
+        const uint32_t second = rem - minute * 60u;
+        return fat_datetime{
+            (uint16_t)((hour << 11) | (minute << 5) | (second >> 1)),
+            (uint16_t)((year << 9) | md)
+        };
+    }
+
+    namespace _Detail {
+
+    #if defined(__FAT_TIME_H_AVX2)
+        // Unsigned 64-bit a > b
+        inline __m256i fat_cmpgt_epu64( __m256i a, __m256i b )
+        {
+            const __m256i bias = _mm256_set1_epi64x((long long)0x8000000000000000ull);
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+        }
+
+        // Four epochs (64-bit lanes) to (seconds since 1980, clamped) in 64-bit lanes
+        inline __m256i fat_clamp_epoch( __m256i v )
+        {
+            const __m256i lo = _mm256_set1_epi64x((long long)fat_epoch_min);
+            const __m256i hi = _mm256_set1_epi64x((long long)fat_epoch_max);
+            v = _mm256_blendv_epi8(v, lo, fat_cmpgt_epu64(lo, v));
+            v = _mm256_blendv_epi8(v, hi, fat_cmpgt_epu64(v, hi));
+            return _mm256_sub_epi64(v, lo);
+        }
+
+        inline void fat_from_epoch_avx2( const uint64_t* epochs, fat_datetime* out )
+        {
+            const __m256i e0 = fat_clamp_epoch(_mm256_loadu_si256((const __m256i*)(epochs + 0)));
+            const __m256i e1 = fat_clamp_epoch(_mm256_loadu_si256((const __m256i*)(epochs + 4)));
+            // e / 86400 as (e * 3257812231) >> 48, in 64-bit lanes
+            const __m256i magic = _mm256_set1_epi64x(3257812231ll);
+            const __m256i d0 = _mm256_srli_epi64(_mm256_mul_epu32(e0, magic), 48);
+            const __m256i d1 = _mm256_srli_epi64(_mm256_mul_epu32(e1, magic), 48);
+
+            // pack the low halves of the 64-bit lanes into eight 32-bit lanes
+            const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+            const __m256i e    = _mm256_permute2x128_si256(
+                _mm256_permutevar8x32_epi32(e0, even), _mm256_permutevar8x32_epi32(e1, even), 0x20);
+            const __m256i days = _mm256_permute2x128_si256(
+                _mm256_permutevar8x32_epi32(d0, even), _mm256_permutevar8x32_epi32(d1, even), 0x20);
+            const __m256i sod  = _mm256_sub_epi32(e, _mm256_mullo_epi32(days, _mm256_set1_epi32(86400)));
+
+            // year, correcting the estimate days / 365 by at most one
+            const __m256i one   = _mm256_set1_epi32(1);
+            __m256i year        = _mm256_srli_epi32(_mm256_mullo_epi32(days, _mm256_set1_epi32(45965)), 24);
+            const __m256i info  = _mm256_i32gather_epi32((const int*)fat_year_table::value.data(), year, 4);
+            const __m256i back  = _mm256_cmpgt_epi32(_mm256_and_si256(info, _mm256_set1_epi32(0xFFFF)), days);
+            const __m256i leap  = _mm256_and_si256(_mm256_srlv_epi32(info, _mm256_sub_epi32(_mm256_set1_epi32(16), back)), one);
+            const __m256i start = _mm256_sub_epi32(_mm256_and_si256(info, _mm256_set1_epi32(0xFFFF)),
+                                  _mm256_and_si256(back, _mm256_add_epi32(leap, _mm256_set1_epi32(365))));
+            year                = _mm256_add_epi32(year, back);
+            const __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(leap, _mm256_set1_epi32(366)), _mm256_sub_epi32(days, start));
+            const __m256i md    = _mm256_i32gather_epi32((const int*)fat_month_day_table::value.data(), index, 4);
+            const __m256i date  = _mm256_or_si256(_mm256_slli_epi32(year, 9), md);
+
+            const __m256i hour   = _mm256_srli_epi32(_mm256_mullo_epi32(sod, _mm256_set1_epi32(37283)), 27);
+            const __m256i rem    = _mm256_sub_epi32(sod, _mm256_mullo_epi32(hour, _mm256_set1_epi32(3600)));
+            const __m256i minute = _mm256_srli_epi32(_mm256_mullo_epi32(rem, _mm256_set1_epi32(2185)), 17);
+            const __m256i second = _mm256_sub_epi32(rem, _mm256_mullo_epi32(minute, _mm256_set1_epi32(60)));
+            const __m256i time   = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(hour, 11), _mm256_slli_epi32(minute, 5)),
+                                                   _mm256_srli_epi32(second, 1));
+
+            _mm256_storeu_si256((__m256i*)out, _mm256_or_si256(time, _mm256_slli_epi32(date, 16)));
+        }
+
+        inline void fat_to_epoch_avx2( const fat_datetime* in, uint64_t* out )
+        {
+            const __m256i x     = _mm256_loadu_si256((const __m256i*)in);
+            const __m256i date  = _mm256_srli_epi32(x, 16);
+            const __m256i month = _mm256_and_si256(_mm256_srli_epi32(x, 21), _mm256_set1_epi32(15));
+            const __m256i info  = _mm256_i32gather_epi32((const int*)fat_year_table::value.data(), _mm256_srli_epi32(x, 25), 4);
+            const __m256i leap  = _mm256_and_si256(_mm256_srli_epi32(info, 16), _mm256_set1_epi32(1));
+            const __m256i cum   = _mm256_i32gather_epi32((const int*)fat_month_start_table::value.data(),
+                                  _mm256_or_si256(_mm256_slli_epi32(leap, 4), month), 4);
+            const __m256i days  = _mm256_sub_epi32(_mm256_add_epi32(
+                                  _mm256_add_epi32(_mm256_and_si256(info, _mm256_set1_epi32(0xFFFF)), cum),
+                                  _mm256_and_si256(date, _mm256_set1_epi32(31))), _mm256_set1_epi32(1));
+
+            const __m256i hour   = _mm256_and_si256(_mm256_srli_epi32(x, 11), _mm256_set1_epi32(31));
+            const __m256i minute = _mm256_and_si256(_mm256_srli_epi32(x, 5), _mm256_set1_epi32(63));
+            const __m256i twice  = _mm256_slli_epi32(_mm256_and_si256(x, _mm256_set1_epi32(31)), 1);
+            const __m256i sod    = _mm256_add_epi32(_mm256_add_epi32(
+                                   _mm256_mullo_epi32(hour, _mm256_set1_epi32(3600)),
+                                   _mm256_mullo_epi32(minute, _mm256_set1_epi32(60))), twice);
+            const __m256i t      = _mm256_add_epi32(_mm256_mullo_epi32(days, _mm256_set1_epi32(86400)), sod);
+
+            const __m256i base = _mm256_set1_epi64x((long long)fat_epoch_min);
+            _mm256_storeu_si256((__m256i*)(out + 0), _mm256_add_epi64(_mm256_cvtepu32_epi64(_mm256_castsi256_si128(t)), base));
+            _mm256_storeu_si256((__m256i*)(out + 4), _mm256_add_epi64(_mm256_cvtepu32_epi64(_mm256_extracti128_si256(t, 1)), base));
+        }
+
+        // Four packed timestamps (low 32 bits of each 64-bit lane) to four fat_fields
+        inline __m256i fat_to_fields_avx2( __m256i x )
+        {
+            const __m256i year   = _mm256_add_epi64(_mm256_srli_epi64(x, 25), _mm256_set1_epi64x(1980));
+            const __m256i month  = _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(x, 21), _mm256_set1_epi64x(15)), 16);
+            const __m256i day    = _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(x, 16), _mm256_set1_epi64x(31)), 24);
+            const __m256i hour   = _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(x, 11), _mm256_set1_epi64x(31)), 32);
+            const __m256i minute = _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(x, 5), _mm256_set1_epi64x(63)), 40);
+            const __m256i second = _mm256_slli_epi64(_mm256_and_si256(x, _mm256_set1_epi64x(31)), 49);
+            return _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(year, month), _mm256_or_si256(day, hour)),
+                                   _mm256_or_si256(minute, second));
+        }
+
+        // Four fat_fields to four packed timestamps (low 32 bits of each 64-bit lane)
+        inline __m256i fat_from_fields_avx2( __m256i f )
+        {
+            const __m256i byte   = _mm256_set1_epi64x(0xFF);
+            const __m256i year   = _mm256_slli_epi64(_mm256_sub_epi64(_mm256_and_si256(f, _mm256_set1_epi64x(0xFFFF)), _mm256_set1_epi64x(1980)), 25);
+            const __m256i month  = _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(f, 16), byte), 21);
+            const __m256i day    = _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(f, 24), byte), 16);
+            const __m256i hour   = _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(f, 32), byte), 11);
+            const __m256i minute = _mm256_slli_epi64(_mm256_and_si256(_mm256_srli_epi64(f, 40), byte), 5);
+            const __m256i second = _mm256_and_si256(_mm256_srli_epi64(f, 49), _mm256_set1_epi64x(0x7F));
+            return _mm256_and_si256(_mm256_or_si256(_mm256_or_si256(_mm256_or_si256(year, month), _mm256_or_si256(day, hour)),
+                                    _mm256_or_si256(minute, second)), _mm256_set1_epi64x(0xFFFFFFFF));
+        }
+    #endif
+
+    } // namespace _Detail
+
+    // The batch functions write out[i] for each in[i], i in [0, count).
+    // The buffers must not overlap.
+
+    inline void fat_from_epoch_batch( const uint64_t* epochs, size_t count, fat_datetime* out )
+    {
+        size_t i = 0;
+    #if defined(__FAT_TIME_H_AVX2)
+        for (; i + 8u <= count; i += 8u) {
+            _Detail::fat_from_epoch_avx2(epochs + i, out + i);
+        }
+    #endif
+        for (; i < count; ++i) {
+            out[i] = fat_from_epoch(epochs[i]);
+        }
+    }
+
+    inline void fat_to_epoch_batch( const fat_datetime* in, size_t count, uint64_t* out )
+    {
+        size_t i = 0;
+    #if defined(__FAT_TIME_H_AVX2)
+        for (; i + 8u <= count; i += 8u) {
+            _Detail::fat_to_epoch_avx2(in + i, out + i);
+        }
+    #endif
+        for (; i < count; ++i) {
+            out[i] = fat_to_epoch(in[i]);
+        }
+    }
+
+    inline void fat_to_fields_batch( const fat_datetime* in, size_t count, fat_fields* out )
+    {
+        size_t i = 0;
+    #if defined(__FAT_TIME_H_AVX2)
+        static_assert(sizeof(fat_fields) == 8u && sizeof(fat_datetime) == 4u, "unexpected struct padding");
+        for (; i + 4u <= count; i += 4u) {
+            const __m256i x = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i*)(in + i)));
+            _mm256_storeu_si256((__m256i*)(out + i), _Detail::fat_to_fields_avx2(x));
+        }
+    #endif
+        for (; i < count; ++i) {
+            out[i] = fat_to_fields(in[i]);
+        }
+    }
+
+    inline void fat_from_fields_batch( const fat_fields* in, size_t count, fat_datetime* out )
+    {
+        size_t i = 0;
+    #if defined(__FAT_TIME_H_AVX2)
+        const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+        for (; i + 4u <= count; i += 4u) {
+            const __m256i x = _Detail::fat_from_fields_avx2(_mm256_loadu_si256((const __m256i*)(in + i)));
+            _mm_storeu_si128((__m128i*)(out + i), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(x, even)));
+        }
+    #endif
+        for (; i < count; ++i) {
+            out[i] = fat_from_fields(in[i]);
+        }
+    }
+
+} // namespace SimpleHacks
+
+#endif // __cpp_constexpr >= 201304
+
+#endif // #ifndef FAT_TIME_H
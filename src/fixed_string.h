@@ -0,0 +1,227 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef SIMPLEHACKS_FIXED_STRING_H
+#define SIMPLEHACKS_FIXED_STRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A fixed-capacity string, whose length is part of its type.
+// All operations are constexpr, so strings can be composed at compile time:
+//
+//     using namespace SimpleHacks::CompileTime;
+//     constexpr auto prefix = make_fixed_string("[net] ") + make_fixed_string("rx: ");
+//     static_assert(prefix.size() == 10, "");
+//     puts(prefix.c_str());
+//
+// In C++20, fixed_string is a structural type, so it can also be used as a
+// non-type template parameter:
+//
+//     template<fixed_string Name> struct tag { ... };
+//     tag<"alpha"> a;
+
+#if __cpp_constexpr >= 201304
+    // avr gcc -- not supported (as of v 5.4.0)
+    // gcc   5.1.0 and higher, using -std=c++14
+    // clang 3.4.0 and higher, using -std=c++14
+    // msvc  19.10 and higher
+
+namespace SimpleHacks {
+namespace CompileTime {
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail
+    {
+        // Length of substr<Pos, Len>() on a string of length N.  A Pos past the
+        // end gives zero rather than wrapping, so substr()'s static_assert reports it.
+        constexpr size_t fixed_substr_length( size_t n, size_t pos, size_t len )
+        {
+            return (pos > n) ? 0 : ((n - pos) < len) ? (n - pos) : len;
+        }
+    }
+
+    // N is the length of the string, excluding the terminating null.
+    template<size_t N>
+    struct fixed_string
+    {
+        static constexpr size_t npos = (size_t)-1;
+
+        // Public, so the type is structural (C++20 non-type template parameter)
+        char value[N + 1];
+
+        constexpr fixed_string() : value{} {}
+
+        constexpr fixed_string( char const (&s)[N + 1] ) : value{}
+        {
+            for (size_t i = 0; i < N; ++i) {
+                value[i] = s[i];
+            }
+        }
+
+        static constexpr size_t size()   { return N; }
+        static constexpr size_t length() { return N; }
+        static constexpr bool   empty()  { return N == 0; }
+
+        constexpr const char* c_str() const { return value; }
+        constexpr const char* data()  const { return value; }
+        constexpr const char* begin() const { return value; }
+        constexpr const char* end()   const { return value + N; }
+
+        constexpr char  operator[]( size_t i ) const { return value[i]; }
+        constexpr char& operator[]( size_t i )       { return value[i]; }
+
+        // Concatenation
+        template<size_t M>
+        constexpr fixed_string<N + M> operator+( const fixed_string<M>& other ) const
+        {
+            fixed_string<N + M> result;
+            for (size_t i = 0; i < N; ++i) {
+                result.value[i] = value[i];
+            }
+            for (size_t i = 0; i < M; ++i) {
+                result.value[N + i] = other.value[i];
+            }
+            return result;
+        }
+        template<size_t M>
+        constexpr fixed_string<N + M - 1> operator+( char const (&s)[M] ) const
+        {
+            return *this + fixed_string<M - 1>(s);
+        }
+
+        // Substring of (up to) Len characters starting at Pos.
+        // The length of the result must be known at compile time, hence template arguments.
+        template<size_t Pos, size_t Len = npos>
+        constexpr fixed_string<_Detail::fixed_substr_length(N, Pos, Len)> substr() const
+        {
+            static_assert( Pos <= N, "substr() position is past the end of the string" );
+            fixed_string<_Detail::fixed_substr_length(N, Pos, Len)> result;
+            for (size_t i = 0; i < result.size(); ++i) {
+                result.value[i] = value[Pos + i];
+            }
+            return result;
+        }
+
+        // Index of the first occurrence at or after pos, or npos
+        constexpr size_t find( char c, size_t pos = 0 ) const
+        {
+            for (size_t i = pos; i < N; ++i) {
+                if (value[i] == c) {
+                    return i;
+                }
+            }
+            return npos;
+        }
+        template<size_t M>
+        constexpr size_t find( const fixed_string<M>& s, size_t pos = 0 ) const
+        {
+            for (size_t i = pos; i + M <= N; ++i) {
+                size_t j = 0;
+                while (j < M && value[i + j] == s.value[j]) {
+                    ++j;
+                }
+                if (j == M) {
+                    return i;
+                }
+            }
+            return npos;
+        }
+        template<size_t M>
+        constexpr size_t find( char const (&s)[M], size_t pos = 0 ) const
+        {
+            return find(fixed_string<M - 1>(s), pos);
+        }
+
+        // Lexicographical comparison, as per std::string::compare()
+        template<size_t M>
+        constexpr int compare( const fixed_string<M>& other ) const
+        {
+            for (size_t i = 0; i < N && i < M; ++i) {
+                if (value[i] != other.value[i]) {
+                    return ((unsigned char)value[i] < (unsigned char)other.value[i]) ? -1 : 1;
+                }
+            }
+            return (N < M) ? -1 : (N > M) ? 1 : 0;
+        }
+    };
+    // C++11 rules require the static constexpr variable to be instantiated outside the template
+    template<size_t N>
+    constexpr size_t fixed_string<N>::npos;
+
+    template<size_t N, size_t M>
+    constexpr bool operator==( const fixed_string<N>& a, const fixed_string<M>& b ) { return a.compare(b) == 0; }
+    template<size_t N, size_t M>
+    constexpr bool operator!=( const fixed_string<N>& a, const fixed_string<M>& b ) { return a.compare(b) != 0; }
+    template<size_t N, size_t M>
+    constexpr bool operator< ( const fixed_string<N>& a, const fixed_string<M>& b ) { return a.compare(b) <  0; }
+    template<size_t N, size_t M>
+    constexpr bool operator> ( const fixed_string<N>& a, const fixed_string<M>& b ) { return a.compare(b) >  0; }
+    template<size_t N, size_t M>
+    constexpr bool operator<=( const fixed_string<N>& a, const fixed_string<M>& b ) { return a.compare(b) <= 0; }
+    template<size_t N, size_t M>
+    constexpr bool operator>=( const fixed_string<N>& a, const fixed_string<M>& b ) { return a.compare(b) >= 0; }
+
+    template<size_t M, size_t N>
+    constexpr fixed_string<M - 1 + N> operator+( char const (&a)[M], const fixed_string<N>& b )
+    {
+        return fixed_string<M - 1>(a) + b;
+    }
+
+#if __cpp_deduction_guides >= 201703
+    template<size_t M>
+    fixed_string( char const (&)[M] ) -> fixed_string<M - 1>;
+#endif
+
+    // Deduces the length from a string literal (for C++14, prior to deduction guides)
+    template<size_t M>
+    constexpr fixed_string<M - 1> make_fixed_string( char const (&s)[M] )
+    {
+        return fixed_string<M - 1>(s);
+    }
+
+    // Zero-padded decimal representation of value, keeping the lowest Width digits.
+    // e.g., fixed_string_decimal<4>(2022) ==> "2022", fixed_string_decimal<2>(7) ==> "07"
+    template<size_t Width>
+    constexpr fixed_string<Width> fixed_string_decimal( uint64_t value )
+    {
+        fixed_string<Width> result;
+        for (size_t i = Width; i > 0; --i) {
+            result.value[i - 1] = (char)('0' + (value % 10u));
+            value /= 10u;
+        }
+        return result;
+    }
+
+}  // namespace CompileTime
+}  // namespace SimpleHacks
+
+#endif // __cpp_constexpr >= 201304
+
+#endif // #ifndef SIMPLEHACKS_FIXED_STRING_H
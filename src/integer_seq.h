@@ -34,6 +34,45 @@ SOFTWARE.
 #include <type_traits>
 #include <array>
 
+/**
+    The following, if defined prior to inclusion of this header file,
+    will modify its behavior as noted:
+
+        INTEGER_SEQ_FORCE_PORTABLE
+        -- if defined, make_integer_sequence always uses the pure-template
+           implementation, even when a compiler intrinsic is available.
+           Useful to compare compile-time cost of the two implementations.
+
+        INTEGER_SEQ_SHOW_VERSION_MESSAGE
+        -- if defined, will show which version of make_integer_sequence is selected
+ */
+
+#ifndef __has_builtin
+    #define __has_builtin(x) 0 // Compatibility with compilers lacking __has_builtin.
+#endif
+
+// Compilers that provide an intrinsic to generate integer sequences can create
+// a sequence of any length in constant time, with minimal compiler memory.
+//     __make_integer_seq<integer_sequence, T, N> -- clang 3.8+, msvc 19.0+
+//     integer_sequence<T, __integer_pack(N)...>  -- gcc 8+
+#if defined(INTEGER_SEQ_FORCE_PORTABLE)
+    // use the portable template implementation
+#elif __has_builtin(__make_integer_seq) || (defined(_MSC_VER) && _MSC_VER >= 1900 && !defined(__clang__))
+    #define __INTEGER_SEQ_H_USE_MAKE_INTEGER_SEQ
+#elif __has_builtin(__integer_pack) || (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 8)
+    #define __INTEGER_SEQ_H_USE_INTEGER_PACK
+#endif
+
+#if defined(INTEGER_SEQ_SHOW_VERSION_MESSAGE)
+    #if defined(__INTEGER_SEQ_H_USE_MAKE_INTEGER_SEQ)
+        #pragma message( "make_integer_sequence -- Using __make_integer_seq intrinsic" )
+    #elif defined(__INTEGER_SEQ_H_USE_INTEGER_PACK)
+        #pragma message( "make_integer_sequence -- Using __integer_pack intrinsic" )
+    #else
+        #pragma message( "make_integer_sequence -- Using portable template version" )
+    #endif
+#endif
+
 // A C++11 implementation of std::integer_sequence from C++14
 namespace SimpleHacks {
 namespace CompileTime {
@@ -65,26 +104,65 @@ namespace CompileTime {
     // intended as private namespace to hide details from auto-completion and the like
     namespace _Detail
     {
+        // Metafunction that joins two sequences [0, A) and [0, B) into [0, A+B),
+        // by shifting every element of the second sequence by A.
+        template<typename T, typename First, typename Second>
+        struct concat_iota;
+
+        template<typename T, T... I1, T... I2>
+        struct concat_iota<T, integer_sequence<T, I1...>, integer_sequence<T, I2...>>
+        {
+            using type = integer_sequence<T, I1..., static_cast<T>(sizeof...(I1) + I2)...>;
+        };
+
         // Metafunction that generates an integer_sequence of T containing [0, N)
-        template<typename T, T Nt, std::size_t N>
+        // Splits the range in half at each step, so the nesting depth is O(log N)
+        // and only O(log N) distinct iota<> types are instantiated (N/2 and N-N/2
+        // differ by at most one, so both halves share almost all of their sub-trees).
+        template<typename T, std::size_t N>
         struct iota
         {
-            static_assert( Nt >= 0, "N cannot be negative" );
-            using type = typename iota<T, Nt-1, N-1>::type::next;
+            using type = typename concat_iota<
+                T,
+                typename iota<T, N/2    >::type,
+                typename iota<T, N - N/2>::type
+                >::type;
         };
 
-        // Terminal case of the recursive metafunction.
-        template<typename T, T Nt>
-        struct iota<T, Nt, 0ul>
+        // Terminal cases of the recursive metafunction.
+        template<typename T>
+        struct iota<T, 0ul>
         {
             using type = integer_sequence<T>;
         };
+        template<typename T>
+        struct iota<T, 1ul>
+        {
+            using type = integer_sequence<T, 0>;
+        };
+
+        // Validates N before handing it to iota, so a negative N reports a
+        // single error instead of recursing on a huge std::size_t.
+        template<typename T, T Nt>
+        struct make_iota
+        {
+            static_assert( Nt >= 0, "N cannot be negative" );
+            using type = typename iota<T, (Nt < 0) ? 0ul : static_cast<std::size_t>(Nt)>::type;
+        };
     }
 
     // Simplify creation of std::integer_sequence and std::index_sequence types with 0, 1, 2, ..., N-1 as Ints
     // ALIAS:  make_integer_sequence<T, N> ==> integer_sequence<T, 0,...N-1>
+#if defined(__INTEGER_SEQ_H_USE_MAKE_INTEGER_SEQ)
+    template<typename T, T N>
+    using make_integer_sequence = __make_integer_seq<integer_sequence, T, N>;
+#elif defined(__INTEGER_SEQ_H_USE_INTEGER_PACK)
+    template<typename T, T N>
+    using make_integer_sequence = integer_sequence<T, __integer_pack(N)...>;
+#else
     template<typename T, T N>
-    using make_integer_sequence = typename _Detail::iota<T, N, N>::type;
+    using make_integer_sequence = typename _Detail::make_iota<T, N>::type;
+#endif
 
     // Simplify creation for the common case where T is std::size_t
     // ALIAS:  make_index_sequence<N>      ==> make_integer_sequence<std:size_t, N>
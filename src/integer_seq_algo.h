@@ -0,0 +1,331 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef SIMPLEHACKS_INTEGER_SEQ_ALGO_H
+#define SIMPLEHACKS_INTEGER_SEQ_ALGO_H
+
+#include <cstddef>
+#include <type_traits>
+#include <array>
+
+#include "integer_seq.h"
+
+// Metafunctions over integer_sequence: concat, reverse, slice, filter, sort
+// and permute, plus to_array() to get the elements as a constexpr std::array.
+//
+//     using namespace SimpleHacks::CompileTime;
+//     using S = index_sequence<3, 1, 2, 0>;
+//     static_assert(std::is_same<sort_sequence<S>,    index_sequence<0, 1, 2, 3>>::value, "");
+//     static_assert(std::is_same<reverse_sequence<S>, index_sequence<0, 2, 1, 3>>::value, "");
+//     constexpr auto arr = to_array(S{});   // std::array<std::size_t, 4>{{ 3, 1, 2, 0 }}
+//
+// Elements are read through a static constexpr array, rather than by peeling
+// one element per recursion, so reverse, slice and permute instantiate O(1)
+// types and filter evaluates O(log N)-deep constexpr calls.  sort is a merge
+// sort with O(log N) nesting depth, where each merge finds every output
+// element with a binary search rather than by recursing over the inputs.
+namespace SimpleHacks {
+namespace CompileTime {
+
+    // Default comparison for sort_sequence<>
+    struct sequence_less {
+        template<typename T>
+        constexpr bool operator()(T a, T b) const { return a < b; }
+    };
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail
+    {
+        template<bool... B>
+        struct bool_pack {};
+
+        // true if every B is true, without recursing over the pack
+        template<bool... B>
+        struct all_of : std::is_same<bool_pack<true, B...>, bool_pack<B..., true>> {};
+
+        // Random access to the elements of a sequence.
+        // The trailing element keeps the array non-empty for an empty sequence.
+        template<typename Seq>
+        struct sequence_values;
+
+        template<typename T, T... V>
+        struct sequence_values<integer_sequence<T, V...>>
+        {
+            static constexpr T value[sizeof...(V) + 1] = { V..., T() };
+        };
+        // C++11 rules require the static constexpr variable to be instantiated outside the template
+        template<typename T, T... V>
+        constexpr T sequence_values<integer_sequence<T, V...>>::value[sizeof...(V) + 1];
+
+        // gather<Seq, index_sequence<K...>> ==> integer_sequence<T, Seq[K]...>
+        template<typename Seq, typename Indices>
+        struct gather;
+
+        template<typename T, T... V, std::size_t... K>
+        struct gather<integer_sequence<T, V...>, integer_sequence<std::size_t, K...>>
+        {
+            static_assert( all_of<(K < sizeof...(V))...>::value, "Index out of range of the sequence" );
+            using type = integer_sequence<T, sequence_values<integer_sequence<T, V...>>::value[K]...>;
+        };
+
+        // index_sequence<Offset + K...> or, when Reverse, index_sequence<Offset - K...>
+        template<std::size_t Offset, bool Reverse, typename Indices>
+        struct offset_indices;
+
+        template<std::size_t Offset, std::size_t... K>
+        struct offset_indices<Offset, false, integer_sequence<std::size_t, K...>>
+        {
+            using type = integer_sequence<std::size_t, (Offset + K)...>;
+        };
+        template<std::size_t Offset, std::size_t... K>
+        struct offset_indices<Offset, true, integer_sequence<std::size_t, K...>>
+        {
+            using type = integer_sequence<std::size_t, (Offset - K)...>;
+        };
+
+        template<typename Seq, std::size_t Begin, std::size_t Count>
+        struct slice
+        {
+            static_assert( Begin <= static_cast<std::size_t>(Seq::size) && Count <= static_cast<std::size_t>(Seq::size) - Begin, "Slice out of range of the sequence" );
+            using type = typename gather<
+                Seq,
+                typename offset_indices<Begin, false, make_index_sequence<static_cast<int>(Count)>>::type
+                >::type;
+        };
+
+        // Seq::size has the sequence's value type, so the last index is
+        // computed as std::size_t (and not at all for an empty sequence).
+        template<typename Seq>
+        struct reverse
+        {
+            static constexpr std::size_t size = static_cast<std::size_t>(Seq::size);
+            using type = typename gather<
+                Seq,
+                typename offset_indices<(size ? size - 1 : 0), true, make_index_sequence<static_cast<int>(size)>>::type
+                >::type;
+        };
+
+        // Joins up to four sequences per step
+        template<typename... Seqs>
+        struct concat;
+
+        template<typename T, T... A>
+        struct concat<integer_sequence<T, A...>>
+        {
+            using type = integer_sequence<T, A...>;
+        };
+        template<typename T, T... A, T... B>
+        struct concat<integer_sequence<T, A...>, integer_sequence<T, B...>>
+        {
+            using type = integer_sequence<T, A..., B...>;
+        };
+        template<typename T, T... A, T... B, T... C>
+        struct concat<integer_sequence<T, A...>, integer_sequence<T, B...>, integer_sequence<T, C...>>
+        {
+            using type = integer_sequence<T, A..., B..., C...>;
+        };
+        template<typename T, T... A, T... B, T... C, T... D, typename... Rest>
+        struct concat<integer_sequence<T, A...>, integer_sequence<T, B...>, integer_sequence<T, C...>, integer_sequence<T, D...>, Rest...>
+            : concat<integer_sequence<T, A..., B..., C..., D...>, Rest...>
+        {
+        };
+
+        // Number of true flags in [lo, hi), and the index of the n'th one.
+        // Both split the range in half, so the constexpr call depth is O(log N).
+        constexpr std::size_t count_true(const bool* f, std::size_t lo, std::size_t hi)
+        {
+            return (hi - lo == 0) ? 0 :
+                   (hi - lo == 1) ? (f[lo] ? 1 : 0) :
+                   count_true(f, lo, lo + (hi - lo) / 2) + count_true(f, lo + (hi - lo) / 2, hi);
+        }
+        constexpr std::size_t nth_true_split(const bool* f, std::size_t lo, std::size_t mid, std::size_t hi, std::size_t n, std::size_t left);
+        constexpr std::size_t nth_true(const bool* f, std::size_t lo, std::size_t hi, std::size_t n)
+        {
+            return (hi - lo == 1) ? lo :
+                   nth_true_split(f, lo, lo + (hi - lo) / 2, hi, n, count_true(f, lo, lo + (hi - lo) / 2));
+        }
+        constexpr std::size_t nth_true_split(const bool* f, std::size_t lo, std::size_t mid, std::size_t hi, std::size_t n, std::size_t left)
+        {
+            return (n < left) ? nth_true(f, lo, mid, n) : nth_true(f, mid, hi, n - left);
+        }
+
+        template<typename Seq, typename Pred>
+        struct filter;
+
+        template<typename T, T... V, typename Pred>
+        struct filter<integer_sequence<T, V...>, Pred>
+        {
+            static constexpr bool flags[sizeof...(V) + 1] = { static_cast<bool>(Pred{}(V))..., false };
+            static constexpr std::size_t count = count_true(flags, 0, sizeof...(V));
+
+            template<typename Indices>
+            struct positions;
+            template<std::size_t... K>
+            struct positions<integer_sequence<std::size_t, K...>>
+            {
+                using type = integer_sequence<std::size_t, nth_true(flags, 0, sizeof...(V), K)...>;
+            };
+
+            using type = typename gather<
+                integer_sequence<T, V...>,
+                typename positions<make_index_sequence<static_cast<int>(count)>>::type
+                >::type;
+        };
+        // C++11 rules require the static constexpr variable to be instantiated outside the template
+        template<typename T, T... V, typename Pred>
+        constexpr bool filter<integer_sequence<T, V...>, Pred>::flags[sizeof...(V) + 1];
+        template<typename T, T... V, typename Pred>
+        constexpr std::size_t filter<integer_sequence<T, V...>, Pred>::count;
+
+        // Merge of two sorted arrays a[0, na) and b[0, nb), taking from a on ties (stable).
+        // After k outputs, merge_split() finds how many came from a, via binary search.
+        // i is too small when a[i] would be output before b[k - i - 1].
+        template<typename T, typename Compare>
+        constexpr bool merge_too_few(const T* a, std::size_t na, const T* b, std::size_t k, std::size_t i)
+        {
+            return i < na && k - i > 0 && !Compare{}(b[k - i - 1], a[i]);
+        }
+        template<typename T, typename Compare>
+        constexpr std::size_t merge_split(const T* a, std::size_t na, const T* b, std::size_t k, std::size_t lo, std::size_t hi)
+        {
+            return (lo >= hi) ? lo :
+                   merge_too_few<T, Compare>(a, na, b, k, lo + (hi - lo) / 2) ?
+                       merge_split<T, Compare>(a, na, b, k, lo + (hi - lo) / 2 + 1, hi) :
+                       merge_split<T, Compare>(a, na, b, k, lo, lo + (hi - lo) / 2);
+        }
+        template<typename T, typename Compare>
+        constexpr T merge_pick(const T* a, std::size_t na, const T* b, std::size_t nb, std::size_t i, std::size_t j)
+        {
+            return (i < na && (j == nb || !Compare{}(b[j], a[i]))) ? a[i] : b[j];
+        }
+        template<typename T, typename Compare>
+        constexpr T merge_at(const T* a, std::size_t na, const T* b, std::size_t nb, std::size_t k, std::size_t i)
+        {
+            return merge_pick<T, Compare>(a, na, b, nb, i, k - i);
+        }
+        template<typename T, typename Compare>
+        constexpr T merge_element(const T* a, std::size_t na, const T* b, std::size_t nb, std::size_t k)
+        {
+            return merge_at<T, Compare>(a, na, b, nb, k,
+                merge_split<T, Compare>(a, na, b, k, (k > nb) ? k - nb : 0, (k < na) ? k : na));
+        }
+
+        template<typename A, typename B, typename Compare, typename Indices>
+        struct merge;
+
+        template<typename T, T... A, T... B, typename Compare, std::size_t... K>
+        struct merge<integer_sequence<T, A...>, integer_sequence<T, B...>, Compare, integer_sequence<std::size_t, K...>>
+        {
+            using type = integer_sequence<T, merge_element<T, Compare>(
+                sequence_values<integer_sequence<T, A...>>::value, sizeof...(A),
+                sequence_values<integer_sequence<T, B...>>::value, sizeof...(B),
+                K)...>;
+        };
+
+        template<typename Seq, typename Compare, std::size_t N = Seq::size>
+        struct sort
+        {
+            using type = typename merge<
+                typename sort<typename slice<Seq, 0, N / 2>::type, Compare>::type,
+                typename sort<typename slice<Seq, N / 2, N - N / 2>::type, Compare>::type,
+                Compare,
+                make_index_sequence<static_cast<int>(N)>
+                >::type;
+        };
+        template<typename Seq, typename Compare>
+        struct sort<Seq, Compare, 0>
+        {
+            using type = Seq;
+        };
+        template<typename Seq, typename Compare>
+        struct sort<Seq, Compare, 1>
+        {
+            using type = Seq;
+        };
+    }
+
+    // The I'th element of a sequence
+    // e.g., sequence_element<1, index_sequence<5, 6, 7>>::value == 6
+    template<std::size_t I, typename Seq>
+    struct sequence_element : std::integral_constant<typename Seq::type, _Detail::sequence_values<Seq>::value[I]>
+    {
+        static_assert( I < static_cast<std::size_t>(Seq::size), "Index out of range of the sequence" );
+    };
+
+    // ALIAS:  concat_sequence<integer_sequence<T, A...>, integer_sequence<T, B...>, ...>
+    //                                     ==> integer_sequence<T, A..., B..., ...>
+    template<typename... Seqs>
+    using concat_sequence = typename _Detail::concat<Seqs...>::type;
+
+    // ALIAS:  reverse_sequence<integer_sequence<T, V0, ... Vn>>
+    //                                     ==> integer_sequence<T, Vn, ... V0>
+    template<typename Seq>
+    using reverse_sequence = typename _Detail::reverse<Seq>::type;
+
+    // ALIAS:  slice_sequence<Seq, Begin, Count>
+    //                                     ==> integer_sequence<T, Seq[Begin], ... Seq[Begin + Count - 1]>
+    template<typename Seq, std::size_t Begin, std::size_t Count>
+    using slice_sequence = typename _Detail::slice<Seq, Begin, Count>::type;
+
+    // Keeps the elements V for which Pred{}(V) is true, in their original order.
+    // Pred must be default constructible, with a constexpr call operator.
+    // ALIAS:  filter_sequence<Seq, Pred>  ==> integer_sequence<T, (each V where Pred{}(V))...>
+    template<typename Seq, typename Pred>
+    using filter_sequence = typename _Detail::filter<Seq, Pred>::type;
+
+    // Stable sort, ordered by Compare{}(a, b) (default: a < b).
+    // Compare must be default constructible, with a constexpr call operator.
+    // ALIAS:  sort_sequence<Seq, Compare> ==> integer_sequence<T, (sorted elements)...>
+    template<typename Seq, typename Compare = sequence_less>
+    using sort_sequence = typename _Detail::sort<Seq, Compare>::type;
+
+    // Applies a permutation, or any gather pattern (indices may repeat or be omitted).
+    // ALIAS:  permute_sequence<Seq, index_sequence<P...>>
+    //                                     ==> integer_sequence<T, Seq[P]...>
+    template<typename Seq, typename Indices>
+    using permute_sequence = typename _Detail::gather<Seq, Indices>::type;
+
+    // true if Seq contains each of 0, 1, ... N-1 exactly once
+    template<typename Seq>
+    struct is_permutation_sequence : std::is_same<
+        sort_sequence<Seq>,
+        make_integer_sequence<typename Seq::type, static_cast<typename Seq::type>(Seq::size)>
+        > {};
+
+    // Returns the elements of a sequence as a constexpr std::array.
+    template<typename T, T... V>
+    constexpr std::array<T, sizeof...(V)> to_array(integer_sequence<T, V...>)
+    {
+        return std::array<T, sizeof...(V)>{{ V... }};
+    }
+
+}  // namespace CompileTime
+}  // namespace SimpleHacks
+
+#endif  // SIMPLEHACKS_INTEGER_SEQ_ALGO_H
@@ -0,0 +1,193 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef ISO8601_FORMAT_H
+#define ISO8601_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Formats seconds since 1970-01-01 (UTC) into the same fixed layout as
+// __DATE_ISO8601_DATETIME__ from compile_date.h:
+//     "YYYY-MM-DDThh:mm:ss"
+//      0....-....1....-...  -- indices to each character, plus a terminating null
+//
+// Each pair of digits is copied from a 200-character lookup table, so there
+// is no per-digit division loop, and no allocation.  The batch function
+// converts the digits of each timestamp with SSSE3 when available.
+
+#if __cpp_constexpr >= 201304
+    // avr gcc -- not supported (as of v 5.4.0)
+    // gcc   5.1.0 and higher, using -std=c++14
+    // clang 3.4.0 and higher, using -std=c++14
+    // msvc  19.10 and higher
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__SSSE3__)
+    #include <tmmintrin.h>
+    #define __ISO8601_FORMAT_H_SSSE3
+#endif
+
+namespace SimpleHacks {
+
+    // Characters written by format_iso8601(), including the terminating null
+    static constexpr size_t iso8601_length = 20u;
+
+    // The last second with a four-digit year, 9999-12-31T23:59:59.
+    // Later timestamps are formatted as this one.
+    static constexpr uint64_t iso8601_epoch_max = 253402300799ull;
+
+    struct iso8601_civil
+    {
+        unsigned year;     // 1970..9999, larger years are formatted as 9999
+        unsigned month;    // 1..12
+        unsigned day;      // 1..31
+        unsigned hour;     // 0..23
+        unsigned minute;   // 0..59
+        unsigned seconds;  // 0..59
+    };
+
+    // Inverse of days_from_civil() (civil_from_days() by Howard Hinnant).
+    // The divisions are all by constants, which compilers turn into multiplies.
+    constexpr inline iso8601_civil iso8601_from_epoch( uint64_t epoch )
+    {
+        const uint64_t days = epoch / 86400u;
+        const unsigned sod  = (unsigned)(epoch % 86400u);
+
+        const uint64_t z   = days + 719468u;
+        const uint64_t era = z / 146097u;
+        const unsigned doe = (unsigned)(z - era * 146097u);                        // [0, 146096]
+        const unsigned yoe = (doe - doe / 1460u + doe / 36524u - doe / 146096u) / 365u; // [0, 399]
+        const unsigned doy = doe - (365u * yoe + yoe / 4u - yoe / 100u);           // [0, 365]
+        const unsigned mp  = (5u * doy + 2u) / 153u;                               // [0, 11], March == 0
+        const unsigned d   = doy - (153u * mp + 2u) / 5u + 1u;
+        const unsigned m   = (mp < 10u) ? (mp + 3u) : (mp - 9u);
+        const unsigned y   = (unsigned)(yoe + era * 400u) + (m <= 2u);
+
+        return iso8601_civil{ y, m, d, sod / 3600u, (sod / 60u) % 60u, sod % 60u };
+    }
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail {
+
+        // Two ASCII digits for each value in [0, 100)
+        constexpr inline const char* iso8601_digit_pairs()
+        {
+            return
+                "00010203040506070809"
+                "10111213141516171819"
+                "20212223242526272829"
+                "30313233343536373839"
+                "40414243444546474849"
+                "50515253545556575859"
+                "60616263646566676869"
+                "70717273747576777879"
+                "80818283848586878889"
+                "90919293949596979899";
+        }
+
+        // Values past 99 are written as "99", rather than reading past the table
+        constexpr inline void iso8601_put2( char* out, unsigned value )
+        {
+            value = (value < 100u) ? value : 99u;
+            out[0] = iso8601_digit_pairs()[2u * value     ];
+            out[1] = iso8601_digit_pairs()[2u * value + 1u];
+        }
+
+    } // namespace _Detail
+
+    // Writes "YYYY-MM-DDThh:mm:ss" plus a terminating null (20 characters) to out
+    constexpr inline char* format_iso8601( const iso8601_civil& c, char* out )
+    {
+        const unsigned year = (c.year < 9999u) ? c.year : 9999u;
+        _Detail::iso8601_put2(out +  0, year / 100u);
+        _Detail::iso8601_put2(out +  2, year % 100u);
+        out[4]  = '-';
+        _Detail::iso8601_put2(out +  5, c.month);
+        out[7]  = '-';
+        _Detail::iso8601_put2(out +  8, c.day);
+        out[10] = 'T';
+        _Detail::iso8601_put2(out + 11, c.hour);
+        out[13] = ':';
+        _Detail::iso8601_put2(out + 14, c.minute);
+        out[16] = ':';
+        _Detail::iso8601_put2(out + 17, c.seconds);
+        out[19] = '\0';
+        return out;
+    }
+    constexpr inline char* format_iso8601( uint64_t epoch, char* out )
+    {
+        return format_iso8601(iso8601_from_epoch((epoch < iso8601_epoch_max) ? epoch : iso8601_epoch_max), out);
+    }
+
+    namespace _Detail {
+
+    #if defined(__ISO8601_FORMAT_H_SSSE3)
+        // Converts the seven two-digit values to ASCII in one vector: the tens
+        // are found with a multiply-high (x * 6554 >> 16 == x / 10 for x < 100),
+        // and one shuffle places the digits around the separators.
+        inline void format_iso8601_ssse3( const iso8601_civil& c, char* out )
+        {
+            const __m128i values = _mm_setr_epi16(
+                (short)(c.year / 100u), (short)(c.year % 100u), (short)c.month, (short)c.day,
+                (short)c.hour, (short)c.minute, (short)c.seconds, 0);
+            const __m128i tens   = _mm_mulhi_epu16(values, _mm_set1_epi16(6554));
+            const __m128i ones   = _mm_sub_epi16(values, _mm_mullo_epi16(tens, _mm_set1_epi16(10)));
+            // tens in the low byte, ones in the high byte of each 16-bit lane
+            const __m128i digits = _mm_add_epi8(_mm_or_si128(tens, _mm_slli_epi16(ones, 8)), _mm_set1_epi8('0'));
+            const __m128i text   = _mm_or_si128(
+                _mm_shuffle_epi8(digits, _mm_setr_epi8(0, 1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10, 11)),
+                _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 'T', 0, 0, ':', 0, 0));
+            _mm_storeu_si128((__m128i*)out, text);
+            out[16] = ':';
+            iso8601_put2(out + 17, c.seconds);
+            out[19] = '\0';
+        }
+    #endif
+
+    } // namespace _Detail
+
+    // Formats count timestamps into out, which must hold count * 20 characters.
+    // Record i is at out + i * 20, and is null-terminated.
+    inline void format_iso8601_batch( const uint64_t* epochs, size_t count, char* out )
+    {
+        for (size_t i = 0; i < count; ++i, out += iso8601_length) {
+    #if defined(__ISO8601_FORMAT_H_SSSE3)
+            const uint64_t epoch = (epochs[i] < iso8601_epoch_max) ? epochs[i] : iso8601_epoch_max;
+            _Detail::format_iso8601_ssse3(iso8601_from_epoch(epoch), out);
+    #else
+            format_iso8601(epochs[i], out);
+    #endif
+        }
+    }
+
+} // namespace SimpleHacks
+
+#endif // __cpp_constexpr >= 201304
+
+#endif // #ifndef ISO8601_FORMAT_H
@@ -0,0 +1,252 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef SIMPLEHACKS_SHUFFLE_MASK_H
+#define SIMPLEHACKS_SHUFFLE_MASK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "integer_seq.h"
+#include "integer_seq_algo.h"
+
+// Generates SIMD shuffle masks at compile time, from a byte (or lane) pattern
+// given as an integer_sequence, so the masks follow a change in the pattern
+// instead of being maintained by hand.  e.g.,
+//
+//     using namespace SimpleHacks::CompileTime;
+//     // big-endian 32-bit fields to host order
+//     using swap32 = byte_swap_pattern<4, 16>;
+//     __m128i v = _mm_shuffle_epi8(in, _mm_load_si128((const __m128i*)pshufb_mask<swap32>::value));
+//
+// Element I of a pattern is the index of the source byte (or lane) that
+// lands in position I, or shuffle_zero to clear that position.
+// Every mask is a static constexpr array, aligned for an aligned load, and
+// each pattern is checked against the instruction's rules by static_assert.
+namespace SimpleHacks {
+namespace CompileTime {
+
+    // Clears the corresponding position, where the instruction supports it
+    constexpr int shuffle_zero = -1;
+
+    // ALIAS:  byte_pattern<I...>          ==> integer_sequence<int, I...>
+    template<int... I>
+    using byte_pattern = integer_sequence<int, I...>;
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail
+    {
+        template<typename Pattern>
+        struct int_pattern;
+
+        template<typename T, T... P>
+        struct int_pattern<integer_sequence<T, P...>>
+        {
+            using type = integer_sequence<int, static_cast<int>(P)...>;
+        };
+
+        constexpr bool pshufb_index_in_range(int index)
+        {
+            return index == shuffle_zero || (index >= 0 && index < 16);
+        }
+        // AVX2 vpshufb shuffles each 128-bit lane independently
+        constexpr bool pshufb_index_in_lane(int index, std::size_t position)
+        {
+            return index == shuffle_zero || (index >= 0 && static_cast<std::size_t>(index) / 16 == position / 16);
+        }
+        // bit 7 set clears the byte; otherwise the low four bits select within the lane
+        constexpr std::uint8_t pshufb_byte(int index)
+        {
+            return (index == shuffle_zero) ? 0x80 : static_cast<std::uint8_t>(index % 16);
+        }
+        // any out-of-range index clears the byte
+        constexpr std::uint8_t neon_tbl_byte(int index)
+        {
+            return (index == shuffle_zero) ? 0xFF : static_cast<std::uint8_t>(index);
+        }
+
+        template<typename Pattern, typename Positions>
+        struct pshufb_mask_impl;
+
+        template<int... P, std::size_t... K>
+        struct pshufb_mask_impl<integer_sequence<int, P...>, integer_sequence<std::size_t, K...>>
+        {
+            static_assert( sizeof...(P) == 16 || sizeof...(P) == 32, "pshufb patterns have 16 (SSSE3) or 32 (AVX2) elements" );
+            static_assert( all_of<(P == shuffle_zero || P >= 0)...>::value, "Pattern index is negative, and is not shuffle_zero" );
+            static_assert( all_of<pshufb_index_in_lane(P, K)...>::value, "pshufb cannot move bytes between 128-bit lanes" );
+
+            alignas(sizeof...(P)) static constexpr std::uint8_t value[sizeof...(P)] = { pshufb_byte(P)... };
+        };
+        // C++11 rules require the static constexpr variable to be instantiated outside the template
+        template<int... P, std::size_t... K>
+        alignas(sizeof...(P)) constexpr std::uint8_t pshufb_mask_impl<integer_sequence<int, P...>, integer_sequence<std::size_t, K...>>::value[sizeof...(P)];
+
+        template<typename Pattern>
+        struct permutevar8x32_mask_impl;
+
+        template<int... P>
+        struct permutevar8x32_mask_impl<integer_sequence<int, P...>>
+        {
+            static_assert( sizeof...(P) == 8, "permutevar8x32 patterns have 8 elements" );
+            static_assert( all_of<(P >= 0 && P < 8)...>::value, "permutevar8x32 indices must be in [0, 8), and cannot be shuffle_zero" );
+
+            alignas(32) static constexpr std::int32_t value[8] = { P... };
+        };
+        // C++11 rules require the static constexpr variable to be instantiated outside the template
+        template<int... P>
+        alignas(32) constexpr std::int32_t permutevar8x32_mask_impl<integer_sequence<int, P...>>::value[8];
+
+        template<typename Pattern, std::size_t TableBytes>
+        struct neon_tbl_mask_impl;
+
+        template<int... P, std::size_t TableBytes>
+        struct neon_tbl_mask_impl<integer_sequence<int, P...>, TableBytes>
+        {
+            static_assert( sizeof...(P) == 8 || sizeof...(P) == 16, "NEON tbl patterns have 8 (vtbl, vqtbl) or 16 (vqtbl ... q) elements" );
+            static_assert( TableBytes == 8 || TableBytes == 16 || TableBytes == 24 || TableBytes == 32 || TableBytes == 48 || TableBytes == 64,
+                           "NEON tables are 8, 16, 24, 32 (vtbl1..4, vqtbl1..2) or 48, 64 (vqtbl3..4) bytes" );
+            static_assert( all_of<(P == shuffle_zero || (P >= 0 && static_cast<std::size_t>(P) < TableBytes))...>::value,
+                           "NEON tbl indices must be in [0, TableBytes) or shuffle_zero" );
+
+            alignas(sizeof...(P)) static constexpr std::uint8_t value[sizeof...(P)] = { neon_tbl_byte(P)... };
+        };
+        // C++11 rules require the static constexpr variable to be instantiated outside the template
+        template<int... P, std::size_t TableBytes>
+        alignas(sizeof...(P)) constexpr std::uint8_t neon_tbl_mask_impl<integer_sequence<int, P...>, TableBytes>::value[sizeof...(P)];
+
+        template<std::size_t Count>
+        struct pshufb_rows
+        {
+            alignas(16) std::uint8_t value[Count][16];
+        };
+
+        template<typename F, std::size_t... K>
+        constexpr bool pshufb_rows_in_range(integer_sequence<std::size_t, K...>)
+        {
+            return all_of<pshufb_index_in_range(static_cast<int>(F{}(K / 16, K % 16)))...>::value;
+        }
+        template<typename F, std::size_t... K>
+        constexpr pshufb_rows<sizeof...(K) / 16> make_pshufb_rows(integer_sequence<std::size_t, K...>)
+        {
+            return pshufb_rows<sizeof...(K) / 16>{{ pshufb_byte(static_cast<int>(F{}(K / 16, K % 16)))... }};
+        }
+
+        template<std::size_t ElementBytes, typename Positions>
+        struct byte_swap_pattern_impl;
+
+        template<std::size_t ElementBytes, std::size_t... K>
+        struct byte_swap_pattern_impl<ElementBytes, integer_sequence<std::size_t, K...>>
+        {
+            static_assert( ElementBytes > 0 && sizeof...(K) % ElementBytes == 0, "TotalBytes must be a multiple of ElementBytes" );
+            using type = integer_sequence<int, static_cast<int>(K - K % ElementBytes + (ElementBytes - 1 - K % ElementBytes))...>;
+        };
+
+        constexpr int expand_lane_byte(int lane, std::size_t lane_bytes, std::size_t byte)
+        {
+            return (lane == shuffle_zero) ? shuffle_zero : static_cast<int>(static_cast<std::size_t>(lane) * lane_bytes + byte);
+        }
+
+        template<typename Pattern, std::size_t LaneBytes, typename Positions>
+        struct expand_lanes_impl;
+
+        template<int... P, std::size_t LaneBytes, std::size_t... K>
+        struct expand_lanes_impl<integer_sequence<int, P...>, LaneBytes, integer_sequence<std::size_t, K...>>
+        {
+            static_assert( all_of<(P == shuffle_zero || P >= 0)...>::value, "Pattern index is negative, and is not shuffle_zero" );
+            using type = integer_sequence<int, expand_lane_byte(
+                sequence_values<integer_sequence<int, P...>>::value[K / LaneBytes], LaneBytes, K % LaneBytes)...>;
+        };
+    }
+
+    // Control mask for _mm_shuffle_epi8 (16 elements) or _mm256_shuffle_epi8 (32 elements).
+    // For the AVX2 form, each index must select a byte within its own 128-bit lane.
+    // e.g., pshufb_mask<byte_pattern<3, 2, 1, 0, ...>>::value
+    template<typename Pattern>
+    struct pshufb_mask : _Detail::pshufb_mask_impl<
+        typename _Detail::int_pattern<Pattern>::type,
+        make_index_sequence<static_cast<int>(Pattern::size)>
+        > {};
+
+    // Index vector for _mm256_permutevar8x32_epi32 / _ps, 8 lanes in [0, 8).
+    template<typename Pattern>
+    struct permutevar8x32_mask : _Detail::permutevar8x32_mask_impl<
+        typename _Detail::int_pattern<Pattern>::type
+        > {};
+
+    // Index vector for the NEON table lookups, with 8 or 16 elements.
+    // TableBytes is the size of the table register(s): 8 * N for vtblN_u8,
+    // or 16 * N for vqtblN_u8 / vqtblNq_u8 (AArch64).  shuffle_zero is
+    // encoded as 0xFF, which every form treats as out of range, giving zero.
+    template<typename Pattern, std::size_t TableBytes = 16>
+    struct neon_tbl_mask : _Detail::neon_tbl_mask_impl<
+        typename _Detail::int_pattern<Pattern>::type,
+        TableBytes
+        > {};
+
+    // A table of Count pshufb masks, value[Count][16], for selecting a mask at runtime.
+    // F must be default constructible, with a constexpr call operator
+    // F{}(entry, position) returning the source index (or shuffle_zero).
+    template<typename F, std::size_t Count>
+    struct pshufb_mask_table
+    {
+        static_assert( _Detail::pshufb_rows_in_range<F>(make_index_sequence<static_cast<int>(Count * 16)>{}),
+                       "pshufb indices must be in [0, 16) or shuffle_zero" );
+
+        static constexpr _Detail::pshufb_rows<Count> rows = _Detail::make_pshufb_rows<F>(make_index_sequence<static_cast<int>(Count * 16)>{});
+        static constexpr const std::uint8_t (&value)[Count][16] = rows.value;
+    };
+    // C++11 rules require the static constexpr variable to be instantiated outside the template
+    template<typename F, std::size_t Count>
+    constexpr _Detail::pshufb_rows<Count> pshufb_mask_table<F, Count>::rows;
+    template<typename F, std::size_t Count>
+    constexpr const std::uint8_t (&pshufb_mask_table<F, Count>::value)[Count][16];
+
+    // Reverses the bytes of each ElementBytes-sized element, e.g. to load big-endian fields.
+    // ALIAS:  byte_swap_pattern<2, 4>     ==> byte_pattern<1, 0, 3, 2>
+    template<std::size_t ElementBytes, std::size_t TotalBytes>
+    using byte_swap_pattern = typename _Detail::byte_swap_pattern_impl<
+        ElementBytes,
+        make_index_sequence<static_cast<int>(TotalBytes)>
+        >::type;
+
+    // Converts a permutation of LaneBytes-sized lanes into the equivalent byte pattern.
+    // ALIAS:  expand_lanes<byte_pattern<1, shuffle_zero>, 2>
+    //                                     ==> byte_pattern<2, 3, shuffle_zero, shuffle_zero>
+    template<typename Pattern, std::size_t LaneBytes>
+    using expand_lanes = typename _Detail::expand_lanes_impl<
+        typename _Detail::int_pattern<Pattern>::type,
+        LaneBytes,
+        make_index_sequence<static_cast<int>(Pattern::size * LaneBytes)>
+        >::type;
+
+}  // namespace CompileTime
+}  // namespace SimpleHacks
+
+#endif  // SIMPLEHACKS_SHUFFLE_MASK_H
@@ -35,6 +35,15 @@ SOFTWARE.
 // if (static_eval<int, constexpr_strlen("hello, world2")>::value > 7) {
 //     ....
 // }
+//
+// For values that cannot be template arguments (arrays, structs, strings),
+// static_constant<F>::value holds the result of a constexpr functor. e.g.,
+// struct crc_table { constexpr std::array<uint32_t, 256> operator()() const { ... } };
+// uint32_t crc_step(uint32_t c, uint8_t b) {
+//     return static_constant<crc_table>::value[(c ^ b) & 0xFF] ^ (c >> 8);
+// }
+
+#include <type_traits>
 
 #ifndef __has_feature
     #define __has_feature(x) 0 // Compatibility with non-clang compilers.
@@ -51,6 +60,44 @@ SOFTWARE.
     {
         static constexpr T value = V;
     };
+
+    // The result of F{}(), as a single constant-initialized object.
+    // As a constexpr variable, value must be initialized by a constant expression,
+    // so a functor that cannot be evaluated at compile time is an error, rather than
+    // quietly becoming dynamic initialization at startup.  As a static member of a
+    // class template, value is one object (in read-only data) shared by every
+    // translation unit, rather than one copy per use.
+    // F must be default constructible, with a constexpr call operator taking no
+    // arguments: a functor struct, or (C++20) the decltype of a captureless lambda.
+    template<typename F>
+    struct static_constant
+    {
+        using type = typename std::decay<decltype(F{}())>::type;
+        static constexpr type value = F{}();
+    };
+    // C++11 rules require the static constexpr variable to be instantiated outside the template
+    template<typename F>
+    constexpr typename static_constant<F>::type static_constant<F>::value;
+
+    #if __cpp_variable_templates >= 201304
+        // ALIAS:  static_constant_v<F>    ==> static_constant<F>::value
+        template<typename F>
+        constexpr const typename static_constant<F>::type& static_constant_v = static_constant<F>::value;
+    #endif
+
+    #if __cpp_constexpr >= 201603
+        // A reference to a single constant-initialized object holding the
+        // value of the expression, which may only refer to constants. e.g.,
+        // const auto& table = STATIC_CONSTANT(SimpleHacks::CompileTime::make_table<256>(crc32_entry{}));
+        // Requires constexpr lambdas (C++17): before that, the lambda cannot be
+        // called in a constant expression, so a namespace-scope reference would
+        // be bound at startup.
+        #define STATIC_CONSTANT(...) \
+            ([]() -> const auto& { \
+                struct __static_constant_fn { constexpr auto operator()() const { return __VA_ARGS__; } }; \
+                return static_constant<__static_constant_fn>::value; \
+            }())
+    #endif
 #endif
 
 #endif // #ifndef STATIC_EVAL_H
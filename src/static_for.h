@@ -0,0 +1,154 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef SIMPLEHACKS_STATIC_FOR_H
+#define SIMPLEHACKS_STATIC_FOR_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <array>
+
+#include "integer_seq.h"
+
+// Compile-time unrolled loops, expanded through make_index_sequence<N>
+// into straight-line code rather than a loop or recursive templates.  e.g.,
+//
+//     uint8_t header[20];
+//     uint32_t sum = 0;
+//     SimpleHacks::CompileTime::for_each_fixed(header, [&](uint8_t b) { sum += b; });
+//
+//     // unroll by 4, looping over the 1024 / 4 chunks
+//     SimpleHacks::CompileTime::static_for<1024, 4>([&](std::size_t i) { out[i] = in[i] * 2; });
+//
+// The functor is called in index order.  Its return value (if any) is ignored.
+namespace SimpleHacks {
+namespace CompileTime {
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail
+    {
+        // The initializer list guarantees left-to-right evaluation, and the
+        // leading zero keeps the array non-empty when the sequence is empty.
+        template<typename F, std::size_t... I>
+        inline void static_for_constant(F& f, integer_sequence<std::size_t, I...>)
+        {
+            using expand = int[];
+            (void)expand{ 0, ((void)f(std::integral_constant<std::size_t, I>{}), 0)... };
+            (void)f; // unused when the sequence is empty
+        }
+
+        template<typename F, std::size_t... I>
+        inline void static_for_offset(F& f, std::size_t base, integer_sequence<std::size_t, I...>)
+        {
+            using expand = int[];
+            (void)expand{ 0, ((void)f(base + I), 0)... };
+            (void)f; (void)base; // unused when the sequence is empty
+        }
+
+        template<typename T, typename F, std::size_t... I>
+        inline void for_each_fixed_offset(T* p, F& f, integer_sequence<std::size_t, I...>)
+        {
+            using expand = int[];
+            (void)expand{ 0, ((void)f(p[I]), 0)... };
+            (void)f; (void)p; // unused when the sequence is empty
+        }
+
+        // Unroll == 0, or Unroll >= N, selects a fully unrolled loop
+        template<std::size_t N, std::size_t Unroll>
+        struct static_for_unroll : std::integral_constant<bool, (Unroll == 0 || Unroll >= N)> {};
+
+        template<std::size_t N, std::size_t Unroll, typename F>
+        inline void static_for_impl(F& f, std::true_type)
+        {
+            static_for_constant(f, make_index_sequence<static_cast<int>(N)>{});
+        }
+        template<std::size_t N, std::size_t Unroll, typename F>
+        inline void static_for_impl(F& f, std::false_type)
+        {
+            std::size_t base = 0;
+            for (; base != N - N % Unroll; base += Unroll) {
+                static_for_offset(f, base, make_index_sequence<static_cast<int>(Unroll)>{});
+            }
+            static_for_offset(f, base, make_index_sequence<static_cast<int>(N % Unroll)>{});
+        }
+
+        template<std::size_t N, std::size_t Unroll, typename T, typename F>
+        inline void for_each_fixed_impl(T* p, F& f, std::true_type)
+        {
+            for_each_fixed_offset(p, f, make_index_sequence<static_cast<int>(N)>{});
+        }
+        template<std::size_t N, std::size_t Unroll, typename T, typename F>
+        inline void for_each_fixed_impl(T* p, F& f, std::false_type)
+        {
+            T* const end = p + (N - N % Unroll);
+            for (; p != end; p += Unroll) {
+                for_each_fixed_offset(p, f, make_index_sequence<static_cast<int>(Unroll)>{});
+            }
+            for_each_fixed_offset(p, f, make_index_sequence<static_cast<int>(N % Unroll)>{});
+        }
+    }
+
+    // Calls f(i) for each i in [0, N), in order.
+    //
+    // Fully unrolled (the default), i is std::integral_constant<std::size_t, I>,
+    // so f may use it as a template argument, or simply accept a std::size_t.
+    //
+    // With 0 < Unroll < N, runs a loop whose body is Unroll calls to f,
+    // followed by the remaining (N % Unroll) calls; i is then a std::size_t.
+    template<std::size_t N, std::size_t Unroll = 0, typename F>
+    inline void static_for(F&& f)
+    {
+        _Detail::static_for_impl<N, Unroll>(f, _Detail::static_for_unroll<N, Unroll>{});
+    }
+
+    // Calls f(arr[i]) for each element of a fixed-size array, in order.
+    // As with ARRAY_SIZE2(), the length is deduced from the array's type,
+    // so a pointer is rejected at compile time.
+    // The optional Unroll argument has the same meaning as for static_for().
+    template<std::size_t Unroll = 0, typename T, std::size_t N, typename F>
+    inline void for_each_fixed(T (&arr)[N], F&& f)
+    {
+        _Detail::for_each_fixed_impl<N, Unroll>(&arr[0], f, _Detail::static_for_unroll<N, Unroll>{});
+    }
+    template<std::size_t Unroll = 0, typename T, std::size_t N, typename F>
+    inline void for_each_fixed(std::array<T, N>& arr, F&& f)
+    {
+        _Detail::for_each_fixed_impl<N, Unroll>(arr.data(), f, _Detail::static_for_unroll<N, Unroll>{});
+    }
+    template<std::size_t Unroll = 0, typename T, std::size_t N, typename F>
+    inline void for_each_fixed(std::array<T, N> const & arr, F&& f)
+    {
+        _Detail::for_each_fixed_impl<N, Unroll>(arr.data(), f, _Detail::static_for_unroll<N, Unroll>{});
+    }
+
+}  // namespace CompileTime
+}  // namespace SimpleHacks
+
+#endif  // SIMPLEHACKS_STATIC_FOR_H
@@ -0,0 +1,274 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef STATIC_STRING_MAP_H
+#define STATIC_STRING_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "constexpr_hash.h"
+
+// A read-only map from a fixed set of strings to values, built entirely at
+// compile time.  A perfect hash (hash-and-displace) is found during constant
+// evaluation, and stored in flat arrays, so a lookup is one string hash,
+// one probe, and one string compare, with no heap allocation and no startup
+// cost.  e.g.,
+//
+//     using namespace SimpleHacks::CompileTime;
+//     constexpr auto fields = make_static_string_map<int>({
+//         { "length", 1 },
+//         { "offset", 2 },
+//         { "flags",  3 },
+//     });
+//     static_assert(*fields.find("offset") == 2, "");
+//     const int* v = fields.find(runtime_name); // nullptr if not found
+
+#if __cpp_constexpr >= 201304
+    // avr gcc -- not supported (as of v 5.4.0)
+    // gcc   5.1.0 and higher, using -std=c++14
+    // clang 3.4.0 and higher, using -std=c++14
+    // msvc  19.10 and higher
+
+namespace SimpleHacks {
+namespace CompileTime {
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail
+    {
+        // Not constexpr, on purpose.  If constant evaluation reaches these, the
+        // compiler reports an error that includes the function's name.  A map
+        // constructed at runtime (not constexpr) aborts instead, rather than
+        // silently dropping keys.
+        inline void STATIC_STRING_MAP_DUPLICATE_KEY()         { abort(); }
+        inline void STATIC_STRING_MAP_NO_PERFECT_HASH_FOUND() { abort(); }
+
+        constexpr inline size_t string_map_next_pow2( size_t n )
+        {
+            size_t result = 1;
+            while (result < n) {
+                result <<= 1u;
+            }
+            return result;
+        }
+
+        // murmur3 finalizers: FNV-1a's low bits are weak for similar short keys,
+        // so the string hash is mixed once before it is split into bucket/slot
+        constexpr inline uint64_t string_map_mix64( uint64_t x )
+        {
+            x ^= x >> 33u;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33u;
+            x *= 0xC4CEB9FE1A85EC53ull;
+            x ^= x >> 33u;
+            return x;
+        }
+
+        constexpr inline uint32_t string_map_mix32( uint32_t x )
+        {
+            x ^= x >> 16u;
+            x *= 0x85EBCA6Bu;
+            x ^= x >> 13u;
+            x *= 0xC2B2AE35u;
+            x ^= x >> 16u;
+            return x;
+        }
+
+        constexpr inline bool string_map_equal( const char* a, const char* b, size_t len )
+        {
+            for (size_t i = 0; i < len; ++i) {
+                if (a[i] != b[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    // One key/value pair, as passed to make_static_string_map()
+    template<typename V>
+    struct static_string_map_item
+    {
+        const char* key;
+        V           value;
+    };
+
+    // V must be a literal type that is default constructible.
+    // Seed is mixed into every hash; changing it gives an unrelated perfect hash
+    // in the rare case that none is found for a set of keys.
+    template<typename V, size_t N, uint64_t Seed = 0>
+    class static_string_map
+    {
+    public:
+        static constexpr size_t size()         { return N; }
+
+        // Slots are kept at most half full, so the displacement search is short
+        static constexpr size_t slot_count()   { return _Detail::string_map_next_pow2(2 * N); }
+        static constexpr size_t bucket_count() { return _Detail::string_map_next_pow2(N); }
+
+        struct entry
+        {
+            const char* key;    // nullptr for an unused slot
+            size_t      length;
+            V           value;
+        };
+
+        constexpr explicit static_string_map( const static_string_map_item<V> (&items)[N] )
+            : m_displacement{}
+            , m_slots{}
+        {
+            uint64_t hashes[N]  = {};
+            size_t   lengths[N] = {};
+            for (size_t i = 0; i < N; ++i) {
+                lengths[i] = constexpr_strlen(items[i].key);
+                hashes[i]  = hash_of(items[i].key, lengths[i]);
+            }
+
+            // counting sort of the keys by bucket
+            size_t start[bucket_count() + 1] = {};
+            for (size_t i = 0; i < N; ++i) {
+                ++start[bucket_of(hashes[i]) + 1];
+            }
+            size_t largest = 0;
+            for (size_t b = 0; b < bucket_count(); ++b) {
+                largest = (start[b + 1] > largest) ? start[b + 1] : largest;
+                start[b + 1] += start[b];
+            }
+            size_t order[N]                = {};
+            size_t next[bucket_count() + 1] = {};
+            for (size_t b = 0; b <= bucket_count(); ++b) {
+                next[b] = start[b];
+            }
+            for (size_t i = 0; i < N; ++i) {
+                order[next[bucket_of(hashes[i])]++] = i;
+            }
+
+            // place the largest buckets first, while most slots are still free
+            for (size_t count = largest; count > 0; --count) {
+                for (size_t b = 0; b < bucket_count(); ++b) {
+                    if (start[b + 1] - start[b] == count) {
+                        place_bucket(items, hashes, lengths, order + start[b], count, b);
+                    }
+                }
+            }
+        }
+
+        // Returns a pointer to the value for key, or nullptr if key is not in the map
+        constexpr const V* find( const char* key, size_t len ) const
+        {
+            const uint64_t h = hash_of(key, len);
+            const entry&   e = m_slots[slot_of(h, m_displacement[bucket_of(h)])];
+            return (e.key != nullptr && e.length == len && _Detail::string_map_equal(e.key, key, len)) ?
+                &e.value : nullptr;
+        }
+        constexpr const V* find( const char* key ) const
+        {
+            return find(key, constexpr_strlen(key));
+        }
+
+        constexpr bool contains( const char* key ) const
+        {
+            return find(key) != nullptr;
+        }
+
+        // The flat slot array, e.g., to iterate over all entries
+        constexpr const entry* slots() const
+        {
+            return m_slots;
+        }
+
+    private:
+        static constexpr uint64_t hash_of( const char* key, size_t len )
+        {
+            return _Detail::string_map_mix64(constexpr_fnv1a_64(key, len) ^ Seed);
+        }
+        static constexpr size_t bucket_of( uint64_t h )
+        {
+            return (size_t)(h >> 32u) & (bucket_count() - 1u);
+        }
+        static constexpr size_t slot_of( uint64_t h, uint32_t displacement )
+        {
+            return (size_t)_Detail::string_map_mix32((uint32_t)h ^ displacement) & (slot_count() - 1u);
+        }
+
+        constexpr void place_bucket( const static_string_map_item<V> (&items)[N],
+                                     const uint64_t* hashes, const size_t* lengths,
+                                     const size_t* keys, size_t count, size_t bucket )
+        {
+            for (size_t i = 0; i < count; ++i) {
+                for (size_t j = i + 1; j < count; ++j) {
+                    if (lengths[keys[i]] == lengths[keys[j]] &&
+                        _Detail::string_map_equal(items[keys[i]].key, items[keys[j]].key, lengths[keys[i]])) {
+                        _Detail::STATIC_STRING_MAP_DUPLICATE_KEY();
+                    }
+                }
+            }
+            for (uint32_t d = 0; d < (1u << 20u); ++d) {
+                bool fits = true;
+                for (size_t i = 0; fits && i < count; ++i) {
+                    const size_t slot = slot_of(hashes[keys[i]], d);
+                    fits = (m_slots[slot].key == nullptr);
+                    for (size_t j = 0; fits && j < i; ++j) {
+                        fits = (slot != slot_of(hashes[keys[j]], d));
+                    }
+                }
+                if (fits) {
+                    m_displacement[bucket] = d;
+                    for (size_t i = 0; i < count; ++i) {
+                        entry& e = m_slots[slot_of(hashes[keys[i]], d)];
+                        e.key    = items[keys[i]].key;
+                        e.length = lengths[keys[i]];
+                        e.value  = items[keys[i]].value;
+                    }
+                    return;
+                }
+            }
+            _Detail::STATIC_STRING_MAP_NO_PERFECT_HASH_FOUND();
+        }
+
+        uint32_t m_displacement[bucket_count()];
+        entry    m_slots[slot_count()];
+    };
+
+    // Deduces N from the braced list of items, e.g.,
+    //     constexpr auto m = make_static_string_map<int>({ { "a", 1 }, { "b", 2 } });
+    //     constexpr auto s = make_static_string_map<int, 1>({ ... });  // Seed == 1
+    template<typename V, uint64_t Seed = 0, size_t N>
+    constexpr static_string_map<V, N, Seed> make_static_string_map( const static_string_map_item<V> (&items)[N] )
+    {
+        return static_string_map<V, N, Seed>(items);
+    }
+
+}  // namespace CompileTime
+}  // namespace SimpleHacks
+
+#endif // __cpp_constexpr >= 201304
+
+#endif // #ifndef STATIC_STRING_MAP_H
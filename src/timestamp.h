@@ -65,8 +65,8 @@ SOFTWARE.
 :                                                            12u  /*Dec*/ )
 
 #define __TIMESTAMP_DAY_INT__ ( \
-   (__TIMESTAMP__ [4u] == ' ' ? 0u : __TIMESTAMP__ [4u] - '0') * 10u \
- + (__TIMESTAMP__ [5u] - '0')                                   )
+   (__TIMESTAMP__ [8u] == ' ' ? 0u : __TIMESTAMP__ [8u] - '0') * 10u \
+ + (__TIMESTAMP__ [9u] - '0')                                   )
 
 
 #define __TIMESTAMP_HOUR_INT__ ( \
@@ -90,7 +90,7 @@ SOFTWARE.
 #define __TIMESTAMP_MSDOS_TIME_INT__    ( \
   ( __TIMESTAMP_HOUR_INT__      << 11u) | \
   ( __TIMESTAMP_MINUTE_INT__    <<  5u) | \
-  ( __TIMESTAMP_SECONDS_INT__   <<  0u) )
+  ( __TIMESTAMP_SECONDS_INT__   >>  1u) ) /* two-second resolution */
 
 __TIMESTAMP_H_CONSTEXPR
 static const char __TIMESTAMP_ISO8601_DATE__[] =
@@ -108,7 +108,7 @@ static const char __TIMESTAMP_ISO8601_DATE__[] =
     '\0'
 };
 __TIMESTAMP_H_CONSTEXPR
-const char __TIMESTAMP_ISO8601_DATETIME__[] =
+static const char __TIMESTAMP_ISO8601_DATETIME__[] =
 {
     (char)(( (__TIMESTAMP_YEAR_INT__    / 1000) % 10 ) + '0'),
     (char)(( (__TIMESTAMP_YEAR_INT__    /  100) % 10 ) + '0'),
@@ -0,0 +1,134 @@
+/**
+
+The MIT License (MIT)
+
+Copyright (c) SimpleHacks, Henry Gabryjelski
+https://github.com/SimpleHacks/UtilHeaders
+
+All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+*/
+
+#ifndef SIMPLEHACKS_TUPLE_ALGO_H
+#define SIMPLEHACKS_TUPLE_ALGO_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <tuple>
+
+#include "integer_seq.h"
+
+// Non-recursive algorithms over tuples, for C++11.  e.g.,
+//
+//     std::tuple<uint8_t, uint16_t, uint32_t> record;
+//     SimpleHacks::CompileTime::tuple_for_each(record, [&](uint32_t field) { out.write(field); });
+//     auto doubled = SimpleHacks::CompileTime::tuple_transform(record, [](uint32_t f) { return f * 2; });
+//     auto sum     = SimpleHacks::CompileTime::tuple_apply([](int a, int b, int c) { return a + b + c; }, record);
+//
+// Each expands std::get<I>... over make_index_sequence in a single function,
+// so there is no chain of recursive calls for the optimizer to inline, and
+// only a constant number of templates is instantiated per tuple type.
+// Anything supporting std::tuple_size and std::get may be used as the tuple:
+// std::tuple, std::pair, std::array, or std::tie(...) of a struct's fields.
+namespace SimpleHacks {
+namespace CompileTime {
+
+    // ALIAS:  tuple_indices<Tuple>        ==> make_index_sequence<std::tuple_size<Tuple>::value>
+    //                                     ==> integer_sequence<std::size_t, 0, ...N-1>
+    template<typename Tuple>
+    using tuple_indices = make_index_sequence<static_cast<int>(std::tuple_size<typename std::decay<Tuple>::type>::value)>;
+
+    // intended as private namespace to hide details from auto-completion and the like
+    namespace _Detail
+    {
+        // Calls f on a single element.  Each std::get<I> is resolved while
+        // instantiating its own small function, rather than all of them within
+        // one expression, which roughly halves gcc's peak memory for wide tuples.
+        template<std::size_t I, typename Tuple, typename F>
+        inline void tuple_visit(Tuple&& t, F& f)
+        {
+            f(std::get<I>(std::forward<Tuple>(t)));
+        }
+
+        // The initializer list guarantees left-to-right evaluation, and the
+        // leading zero keeps the array non-empty when the tuple is empty.
+        template<typename Tuple, typename F, std::size_t... I>
+        inline void tuple_for_each_impl(Tuple&& t, F& f, integer_sequence<std::size_t, I...>)
+        {
+            using expand = int[];
+            (void)expand{ 0, (tuple_visit<I>(std::forward<Tuple>(t), f), 0)... };
+            (void)t; (void)f; // unused when the tuple is empty
+        }
+
+        template<typename Tuple, typename F, std::size_t I>
+        using tuple_transform_element = typename std::decay<
+            decltype(std::declval<F&>()(std::get<I>(std::declval<Tuple>())))
+            >::type;
+
+        // Braced initialization also evaluates f in order, unlike a function call
+        template<typename Tuple, typename F, std::size_t... I>
+        inline std::tuple<tuple_transform_element<Tuple, F, I>...>
+        tuple_transform_impl(Tuple&& t, F& f, integer_sequence<std::size_t, I...>)
+        {
+            (void)t; (void)f; // unused when the tuple is empty
+            return std::tuple<tuple_transform_element<Tuple, F, I>...>{ f(std::get<I>(std::forward<Tuple>(t)))... };
+        }
+
+        template<typename F, typename Tuple, std::size_t... I>
+        constexpr auto tuple_apply_impl(F&& f, Tuple&& t, integer_sequence<std::size_t, I...>)
+            -> decltype(std::forward<F>(f)(std::get<I>(std::forward<Tuple>(t))...))
+        {
+            return std::forward<F>(f)(std::get<I>(std::forward<Tuple>(t))...);
+        }
+    }
+
+    // Calls f(std::get<I>(t)) for each element of t, in order.
+    // The elements are passed as lvalues for an lvalue tuple, so f may modify them.
+    template<typename Tuple, typename F>
+    inline void tuple_for_each(Tuple&& t, F&& f)
+    {
+        _Detail::tuple_for_each_impl(std::forward<Tuple>(t), f, tuple_indices<Tuple>{});
+    }
+
+    // Returns std::tuple{ f(std::get<0>(t)), f(std::get<1>(t)), ... }, calling f in order.
+    // Each result is stored by value (decayed), so f must not return void.
+    template<typename Tuple, typename F>
+    inline auto tuple_transform(Tuple&& t, F&& f)
+        -> decltype(_Detail::tuple_transform_impl(std::forward<Tuple>(t), f, tuple_indices<Tuple>{}))
+    {
+        return _Detail::tuple_transform_impl(std::forward<Tuple>(t), f, tuple_indices<Tuple>{});
+    }
+
+    // Returns f(std::get<0>(t), std::get<1>(t), ...), as std::apply() does in C++17.
+    // Named differently so that argument-dependent lookup of std::apply
+    // cannot make an unqualified call ambiguous.
+    template<typename F, typename Tuple>
+    constexpr auto tuple_apply(F&& f, Tuple&& t)
+        -> decltype(_Detail::tuple_apply_impl(std::forward<F>(f), std::forward<Tuple>(t), tuple_indices<Tuple>{}))
+    {
+        return _Detail::tuple_apply_impl(std::forward<F>(f), std::forward<Tuple>(t), tuple_indices<Tuple>{});
+    }
+
+}  // namespace CompileTime
+}  // namespace SimpleHacks
+
+#endif  // SIMPLEHACKS_TUPLE_ALGO_H